@@ -39,12 +39,120 @@ static const u1_t PROGMEM APPKEY[16] = { 0x4E, 0xF4, 0xD7, 0x33, 0x55, 0x39, 0x3
 #define OLED_ADDR    0x3C // SSD1306 I2C adresi (genellikle 0x3C veya 0x3D)
 #define OLED_WIDTH   128  // OLED genişliği
 #define OLED_HEIGHT  64   // OLED yüksekliği
+#define DISPLAY_MAX_FPS        4    // Ekranın saniyede en fazla yeniden çizilme sayısı
+#define DISPLAY_RADIO_GUARD_MS 50   // RX penceresi öncesi/sonrası çizim yapılmayan süre
 
-// ESP32 saat hatası düzeltme yüzdesi - daha yüksek değerler daha geniş bir hata payı sağlar
+// ESP32 saat hatası düzeltme yüzdesi - daha yüksek değerler daha geniş bir hata payı sağlar.
+// RX kalibrasyonu tamamlanana kadar ve art arda kaçırılan yanıtlardan sonra kullanılır.
 #define CLOCK_ERROR_PERCENTAGE 40
 
-// LMIC_DEBUG_LEVEL değeri (0: devre dışı, 1: hatalar, 2: bilgi, 3: detaylı debug)
+// RX penceresi kalibrasyonu (bkz. Core/Lora/RxCalibration.h)
+#define RX_CALIBRATION        1    // 0: her zaman CLOCK_ERROR_PERCENTAGE (yalnızca ölçüm)
+#define RX_CAL_MIN_SAMPLES    3    // Pencereyi daraltmadan önce gereken ölçüm
+#define RX_CAL_MARGIN         4    // Ölçülen saat hatasının güvenlik katsayısı
+#define RX_CAL_MIN_ERROR_PPM  500  // Uygulanan saat hatasının alt sınırı (DIO yoklama gecikmesi dahil)
+#define RX_CAL_MAX_MISSES     2    // Art arda bu kadar kaçırılan yanıtta geniş ayara dönülür
+
+// Radyo profili (bkz. Core/Lora/RadioProfile.h). Değerler LMIC_reset ve join
+// sonrası bir kez yazılır; ağ sunucusu MAC komutuyla değiştirirse kimin
+// geçerli olacağı parametre başına seçilir
+#define RADIO_POLICY_PROFILE  0    // Profil değeri geri yazılır
+#define RADIO_POLICY_SERVER   1    // Sunucunun değeri kabul edilir (profil yalnızca başlangıç değeri)
+
+#define RADIO_PROFILE_RX_DELAY      5       // RX1 gecikmesi (sn, ChirpStack yapılandırmasıyla eşleşmeli)
+#define RADIO_PROFILE_RX1_DR_OFFSET 0
+#define RADIO_PROFILE_RX2_DR        DR_SF9  // Ağ sunucusu RX2'yi SF9 ile gönderiyor (bölge varsayılanının yerine)
+#define RADIO_PROFILE_DATARATE      DR_SF9  // JOIN ve veri için SF9 (ADR kapalı)
+#define RADIO_PROFILE_TX_POWER      14      // dBm
+// RX2 frekansının profil değeri bölge planındaki varsayılandır
+
+#define RADIO_POLICY_RX_DELAY       RADIO_POLICY_SERVER   // RXTimingSetup
+#define RADIO_POLICY_RX1_DR_OFFSET  RADIO_POLICY_SERVER   // RXParamSetup
+#define RADIO_POLICY_RX2_DR         RADIO_POLICY_SERVER   // RXParamSetup
+#define RADIO_POLICY_RX2_FREQ       RADIO_POLICY_SERVER   // RXParamSetup
+#define RADIO_POLICY_DATARATE       RADIO_POLICY_PROFILE  // LinkADRReq (ADR kapalı)
+#define RADIO_POLICY_TX_POWER       RADIO_POLICY_PROFILE  // LinkADRReq
+
+// Uygulama log seviyesi (0: devre dışı, 1: hatalar, 2: bilgi, 3: detaylı debug)
+// Seviyenin altındaki LOG_* satırları derlemeden tamamen çıkarılır (bkz. Core/Utils/Log.h);
+// üretim için 1 kullanın (derleme bayrağıyla da verilebilir: -DLORA_DEBUG_LEVEL=1)
+#ifndef LORA_DEBUG_LEVEL
 #define LORA_DEBUG_LEVEL 3
+#endif
+
+// Join yeniden deneme ayarları (milisaniye)
+#define JOIN_ATTEMPT_TIMEOUT_MS   90000  // Tek bir join denemesi için azami süre
+#define JOIN_STALL_TIMEOUT_MS     30000  // Join TX bittikten sonra yanıtsız bekleme sınırı
+#define JOIN_BACKOFF_BASE_MS      5000   // İlk yeniden deneme gecikmesi
+#define JOIN_BACKOFF_MAX_MS       600000 // Üstel geri çekilme üst sınırı
+
+// Uplink kuyruğu ayarları
+#define UPLINK_QUEUE_CAPACITY     8      // Kuyruktaki azami mesaj sayısı
+#define UPLINK_SLOT_SIZE          222    // Mesaj başına azami boyut (LoRaWAN en büyük uygulama yükü)
+
+// Uplink birleştirme ayarları
+#define AGGREGATE_PORT            2      // Birleştirilmiş çerçevelerin FPort değeri
+#define AGGREGATE_LATENCY_MS      30000  // İlk kayıttan sonra en geç gönderim süresi
+
+// Onaylı uplink politikası (her N. çerçevede ACK istenir)
+#define CONFIRM_INTERVAL_DEFAULT  8      // Başlangıç N değeri
+#define CONFIRM_INTERVAL_MIN      2      // ACK'lar kayboluyorken en sık kontrol
+#define CONFIRM_INTERVAL_MAX      64     // Bağlantı sağlıklıyken en seyrek kontrol
+#define CONFIRM_RATE_GOOD_PERCENT 90     // Bu oranın üstünde N büyütülür
+#define CONFIRM_RATE_POOR_PERCENT 50     // Bu oranın altında N küçültülür
+
+// Ertelenmiş ikili log hattı
+#define LOG_RING_CAPACITY         64     // Halka tampondaki kayıt sayısı
+#define LOG_FLUSH_BUDGET          4      // Döngü başına en fazla yazılan kayıt
+#define LOG_OUTPUT_BINARY         0      // 1: ham kayıtları gönder (tools/log_decode ile çözülür)
+
+// Üretim seviyesinde cihaz kayıtları biçimlendirmez: çıktı her zaman ikilidir
+// ve kayıt biçim tablosu flash'a girmez (bkz. Core/Utils/LogEvents.h)
+#if LORA_DEBUG_LEVEL <= 1
+#undef LOG_OUTPUT_BINARY
+#define LOG_OUTPUT_BINARY         1
+#endif
+
+// Sıcak yol süre histogramları (STATUS ve PROFILE_DUMP komutları)
+#define PROFILER_ENABLED          1      // 0: ölçüm noktaları derlemeden çıkarılır
+
+// LMIC olay izi (TRACE_DUMP komutu, tools/trace_view ile çözülür)
+#define EVENT_TRACE_CAPACITY      64     // Tutulan son olay sayısı (kayıt başına 28 byte)
+
+// Çift çekirdekli çalışma (ESP32). 1 ile LMIC ve LoraManager sabitlenmiş bir
+// radyo görevinde çalışır; ekran ve Serial Arduino loop() çekirdeğinde kalır
+// ve iki taraf yalnızca sınırlı kilitsiz kuyruklarla haberleşir.
+#define DUAL_CORE_MODE            0
+#define RADIO_TASK_CORE           0      // Arduino loop() çekirdek 1'de çalışır
+#define RADIO_TASK_PRIORITY       5      // loop() görevinin (1) üzerinde
+#define RADIO_TASK_STACK          4096   // Byte
+#define DISPLAY_QUEUE_CAPACITY    16     // Radyo -> ekran komut kuyruğu
+#define UPLINK_INBOX_CAPACITY     4      // UI -> radyo uplink istek kuyruğu
+
+// Ertelenmiş LMIC olay teslimi (handleEvent -> LoraManager::loop -> EventBus)
+#define LORA_EVENT_QUEUE_CAPACITY    16  // Olay kaydı yuvası (kapasite N-1)
+#define LORA_EVENT_SUBSCRIBERS       8   // Olay veriyolu abone yuvası (en fazla 16)
+
+// Downlink komutları (DownlinkCommands, FPort ile DownlinkDispatcher üzerinden)
+#define APP_SEND_INTERVAL_MS        60000  // Varsayılan uplink aralığı; downlink ile değiştirilebilir
+#define DOWNLINK_COMMAND_PORT       10     // Komut çerçevelerinin FPort'u
+#define DOWNLINK_STATUS_PORT        11     // Durum yanıtının uplink FPort'u
+#define DOWNLINK_MIN_INTERVAL_S     10     // Downlink ile kurulabilecek en kısa uplink aralığı
+
+// Kalıcı LoRaWAN oturumu (ESP32: NVS, host: dosya). Yeniden açılışta join atlanır.
+#define SESSION_PERSISTENCE        1
+#define SESSION_STORE_NAMESPACE    "lorawan"       // NVS ad alanı (en fazla 15 karakter)
+#define SESSION_STORE_PATH         "lora_session"  // Host derlemesinde dosya öneki
+#define SESSION_FCNT_SAVE_INTERVAL 32  // FCnt bu kadar uplink'te bir yazılır; açılışta bu kadar ileri atlanır
+
+// Düşük güç modu (LowPower::plan / LowPower::sleep). 1 ile sketch loop()'u her
+// turun sonunda bir sonraki gönderime kadar hafif veya derin uykuya geçer;
+// DUAL_CORE_MODE ile birlikte kullanılamaz (radyo görevi uykuyu bilmez).
+#define LOW_POWER_MODE              0
+#define LOW_POWER_MIN_SLEEP_MS      1000     // Daha kısa boşluklarda uyunmaz
+#define LOW_POWER_MIN_DEEP_SLEEP_MS 10000    // Derin uykudan dönüş (açılış + LMIC) maliyetine değecek en kısa süre
+#define LOW_POWER_MAX_SLEEP_MS      3600000  // Tek uykunun üst sınırı (ostime_t taşmasının çok altında)
+#define LOW_POWER_WAKE_MARGIN_MS    20       // LMIC işinden bu kadar önce uyanılır
 
 // Özel alıcı ayarları
 #define DISABLE_BEACONS 1     // Varsa Beacon özelliğini devre dışı bırakır
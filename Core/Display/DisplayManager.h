@@ -5,28 +5,98 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
 #include <Wire.h>
+#include "../Config/AppConfig.h"
+#include "../Utils/Utils.h"
 
-#define SCREEN_WIDTH 128 // OLED display width, in pixels
-#define SCREEN_HEIGHT 64 // OLED display height, in pixels
-#define OLED_RESET    16 // Reset pin
-#define SCREEN_ADDRESS 0x3C // OLED I2C adresi
+#define OLED_PAGES        (OLED_HEIGHT / 8)  // SSD1306 sayfa sayısı (8 piksel yükseklik)
+#define OLED_I2C_CLOCK    400000             // Ekran aktarımı için I2C saat hızı
+#define OLED_I2C_CHUNK    31                 // Tek I2C işleminde gönderilen veri byte'ı (Wire tamponu 32)
 
+// Ekranda gösterilecek görünüm
+enum DisplayView : uint8_t {
+  VIEW_STARTUP,
+  VIEW_CONNECTION,
+  VIEW_LORA_STATUS,
+  VIEW_SEND_STATUS,
+  VIEW_LAST_VALUES,
+  VIEW_DEBUG
+};
+
+// Çizimden bağımsız ekran durumu; show* çağrıları yalnızca bunu günceller
+struct DisplayViewModel {
+  DisplayView view;
+  bool flag;                // Bağlı / başarılı bilgisi
+  char text[32];
+};
+
+// Ekran aktarımı ölçümleri
+struct DisplayStats {
+  uint32_t renders;         // Çizilen kare sayısı
+  uint32_t coalescedUpdates; // Çizilmeden üzerine yazılan (birleştirilen) güncellemeler
+  uint32_t frames;          // display() çağrı sayısı
+  uint32_t skippedFrames;   // Değişiklik olmadığı için hiç aktarılmayan çerçeveler
+  uint32_t bytesSent;       // I2C üzerinden gönderilen byte (kontrol + komut + veri)
+  uint32_t bytesSaved;      // Tam çerçeve aktarımına göre gönderilmeyen byte
+  uint32_t lastFrameUs;     // Son çerçevenin aktarım süresi
+  uint32_t maxFrameUs;      // En uzun çerçeve aktarım süresi
+};
+
+// show* ve addLogLine çağrıları görünüm modelini güncelleyip "kirli" işaretler;
+// çizim service() içinde en fazla DISPLAY_MAX_FPS kare/sn hızında ve radyo
+// zamanlamasından uzakta yapılır.
 class DisplayManager {
 public:
   DisplayManager();
   bool begin();
+  
+  // Kirli görünümü kare hızı sınırı içinde çiz (ana döngüden çağrılır)
+  // radioBusy: TX veya RX penceresine yakın olunduğunu belirtir, çizim ertelenir
+  void service(bool radioBusy = false);
+  
+  // Görünümü beklemeden hemen çiz (ör. setup sırasında)
+  void renderNow();
+
   void showStartupScreen();
-  void showConnectionStatus(bool connected);
-  void showSendStatus(const char *message, bool success);
-  void showJoinStatus(bool joined);
+  void showConnectionStatus(bool isConnected);
+  void showLoRaStatus(const char* status, bool connected);
+  void showSendStatus(const char* message, bool success);
+  void showLastValues(const char* sensorData);
+  void showDebugInfo(const char* info);
+  void addLogLine(const char* logLine);
   void clear();
+  void display();
   void turnOn();
   void turnOff();
   bool isOn() const;
+  
+  // I2C aktarım sayaçları
+  const DisplayStats& getStats() const;
 
 private:
-  Adafruit_SSD1306 display;
+  Adafruit_SSD1306* oled;
   bool displayOn;
+  
+  // Son olay satırları (halka tampon)
+  char logLines[4][32];
+  uint8_t currentLogLine;
+  
+  // Görünüm modeli ve çizim zamanlayıcısı
+  DisplayViewModel viewModel;
+  bool dirty;
+  bool renderedOnce;
+  uint32_t lastRenderTime;
+  
+  // Ekran belleğinde olduğu bilinen son çerçeve; yalnızca farklı bölgeler gönderilir
+  uint8_t shadow[OLED_WIDTH * OLED_PAGES];
+  bool shadowValid;
+  DisplayStats stats;
+  
+  void setView(DisplayView view, const char* text, bool flag);
+  void markDirty();
+  void renderView();
+  
+  void sendCommands(const uint8_t* commands, uint8_t count);
+  void sendData(const uint8_t* data, uint16_t count);
 };
 
-#endif // DISPLAY_MANAGER_H 
\ No newline at end of file
+#endif // DISPLAY_MANAGER_H
@@ -0,0 +1,50 @@
+#ifndef DISPLAY_PROXY_H
+#define DISPLAY_PROXY_H
+
+#include <Arduino.h>
+#include "../Config/AppConfig.h"
+#include "../Utils/SpscQueue.h"
+#include "DisplayManager.h"
+
+// Ekran komut türleri (DisplayManager'ın radyo tarafından kullanılan çağrıları)
+enum DisplayCommandType : uint8_t {
+  DISPLAY_CMD_LOG_LINE,
+  DISPLAY_CMD_DEBUG_INFO,
+  DISPLAY_CMD_SEND_STATUS,
+  DISPLAY_CMD_CONNECTION,
+  DISPLAY_CMD_LORA_STATUS
+};
+
+struct DisplayCommand {
+  DisplayCommandType type;
+  bool flag;
+  char text[32];
+};
+
+// Radyo tarafı ile ekran arasındaki vekil
+//
+// Radyo kodu DisplayManager'ı doğrudan çağırmaz; aynı isimli çağrılar
+// sınırlı kilitsiz kuyruğa komut olarak eklenir ve ekranın sahibi olan
+// taraf (tek çekirdekte LoraManager::serviceUi, çift çekirdekte UI görevi)
+// applyTo() ile bunları sırasıyla DisplayManager'a uygular. Kuyruk doluysa
+// komut atılır; ekran en iyi çaba esaslıdır ve radyoyu bekletmemelidir.
+class DisplayProxy {
+public:
+  void addLogLine(const char* logLine);
+  void showDebugInfo(const char* info);
+  void showSendStatus(const char* message, bool success);
+  void showConnectionStatus(bool isConnected);
+  void showLoRaStatus(const char* status, bool connected);
+
+  // Bekleyen komutları ekrana uygula (tüketici tarafı); uygulanan komut sayısı döner
+  uint16_t applyTo(DisplayManager& display);
+
+  uint32_t getDropped() const;
+
+private:
+  SpscQueue<DisplayCommand, DISPLAY_QUEUE_CAPACITY> commands;
+
+  void post(DisplayCommandType type, const char* text, bool flag);
+};
+
+#endif // DISPLAY_PROXY_H
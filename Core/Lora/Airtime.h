@@ -0,0 +1,74 @@
+#ifndef AIRTIME_H
+#define AIRTIME_H
+
+// LoRa yayın süresi (time-on-air) hesaplayıcı
+//
+// Semtech SX1276 veri sayfasındaki formül (bölüm 4.1.1.7):
+//   Tsym       = 2^SF / BW
+//   Tpreamble  = (nPreamble + 4.25) * Tsym
+//   nPayload   = 8 + max(ceil((8*PL - 4*SF + 28 + 16*CRC - 20*IH) / (4*(SF - 2*DE))) * (CR + 4), 0)
+//   Toplam     = Tpreamble + nPayload * Tsym
+// DE (düşük veri hızı optimizasyonu) SF11/SF12 ve 125 kHz'de zorunludur.
+//
+// Yalnızca <stdint.h> kullanır; host tarafında da derlenebilir.
+
+#include <stdint.h>
+
+// LoRaWAN uplink çerçeve ek yükü: MHDR(1) + FHDR(7, FOpts yok) + FPort(1) + MIC(4)
+#define LORAWAN_FRAME_OVERHEAD 13
+
+struct LoraTxParams {
+  uint8_t spreadingFactor;   // 7..12
+  uint32_t bandwidthHz;      // 125000, 250000, 500000
+  uint8_t codingRate;        // 1..4 -> 4/5..4/8
+  uint16_t preambleSymbols;  // LoRaWAN için 8
+  bool explicitHeader;       // LoRaWAN uplink için true
+  bool crc;                  // LoRaWAN uplink için true, downlink için false
+};
+
+namespace Airtime {
+
+// Verilen PHY yükü (byte) için yayın süresi, mikrosaniye
+inline uint32_t timeOnAirUs(const LoraTxParams& p, uint8_t payloadBytes) {
+  const int32_t sf = p.spreadingFactor;
+  const int32_t de = (sf >= 11 && p.bandwidthHz <= 125000) ? 1 : 0;
+  const int32_t ih = p.explicitHeader ? 0 : 1;
+  const int32_t crc = p.crc ? 1 : 0;
+  
+  int32_t numerator = 8 * (int32_t)payloadBytes - 4 * sf + 28 + 16 * crc - 20 * ih;
+  int32_t denominator = 4 * (sf - 2 * de);
+  int32_t blocks = numerator > 0 ? (numerator + denominator - 1) / denominator : 0;
+  
+  // Sembol sayısını 4 ile ölçekle (önsözün 0.25 sembolünü tamsayıda tutmak için)
+  uint64_t quarterSymbols = (uint64_t)(p.preambleSymbols * 4 + 17) +
+                            (uint64_t)(8 + blocks * (p.codingRate + 4)) * 4;
+  
+  return (uint32_t)((quarterSymbols * ((uint64_t)1 << sf) * 1000000ULL) /
+                    ((uint64_t)p.bandwidthHz * 4));
+}
+
+inline uint32_t timeOnAirMs(const LoraTxParams& p, uint8_t payloadBytes) {
+  return (timeOnAirUs(p, payloadBytes) + 999) / 1000;
+}
+
+// LoRaWAN uplink varsayılanları ile parametre seti
+inline LoraTxParams uplinkParams(uint8_t spreadingFactor, uint32_t bandwidthHz = 125000) {
+  LoraTxParams p;
+  p.spreadingFactor = spreadingFactor;
+  p.bandwidthHz = bandwidthHz;
+  p.codingRate = 1;
+  p.preambleSymbols = 8;
+  p.explicitHeader = true;
+  p.crc = true;
+  return p;
+}
+
+// Uygulama yükü (FRMPayload) boyutundan uplink yayın süresi, milisaniye
+inline uint32_t uplinkMs(uint8_t spreadingFactor, uint8_t appPayloadBytes, uint32_t bandwidthHz = 125000) {
+  return timeOnAirMs(uplinkParams(spreadingFactor, bandwidthHz),
+                     (uint8_t)(appPayloadBytes + LORAWAN_FRAME_OVERHEAD));
+}
+
+} // namespace Airtime
+
+#endif // AIRTIME_H
@@ -0,0 +1,60 @@
+#ifndef DUTY_CYCLE_LEDGER_H
+#define DUTY_CYCLE_LEDGER_H
+
+#include <Arduino.h>
+#include <lmic.h>
+#include "Airtime.h"
+#include "RegionPlan.h"
+#include "../Utils/Utils.h"
+
+// Bant indeksleri bölge planındaki sırayla aynıdır (EU868: BAND_MILLI, BAND_CENTI, BAND_DECI, BAND_AUX)
+#define DUTY_CYCLE_BANDS REGION_MAX_BANDS
+
+// Alt bant başına görev döngüsü defteri
+//
+// Her iletimden sonra bant, yayın süresi / görev oranı kadar kapalı kalır
+// (ör. %1 bantta 200 ms iletim -> 20 sn). Defter bu süreleri uygulama
+// tarafında tutar; böylece gönderim LMIC içinde sessizce beklemek yerine
+// bant gerçekten açıldığında yapılabilir.
+class DutyCycleLedger {
+public:
+  DutyCycleLedger();
+  
+  // Bir iletimi deftere işle (yayın süresi ms)
+  void recordTransmission(uint8_t band, uint32_t airtimeMs);
+  
+  // LMIC'in o anki iletim parametrelerinden (EV_TXSTART) iletimi işle
+  void recordCurrentTransmission();
+  
+  // Bandın tekrar kullanılabileceği mutlak zaman (ms)
+  uint32_t bandAvailableAt(uint8_t band) const;
+  
+  // Etkin kanallardan herhangi birinin kullanılabileceği en erken zaman (ms)
+  uint32_t nextSendTime() const;
+  
+  // Şu an gönderim yasal mı
+  bool canSendNow() const;
+  
+  // Banda ait toplam yayın süresi (ms) - görev döngüsü bütçesi raporu için
+  uint32_t totalAirtimeMs(uint8_t band) const;
+  
+  // Saat sıfırlanacaksa (derin uyku) zamanları geri kaydır; elapsedMs yeni
+  // saatin sıfırına karşılık gelen eski zamandır
+  void shiftClock(uint32_t elapsedMs);
+  
+  // Verilen veri hızı ve uygulama yükü için uplink yayın süresi (ms)
+  static uint32_t uplinkAirtimeMs(dr_t datarate, uint8_t appPayloadBytes);
+  
+  // Kanalın bağlı olduğu bant
+  static uint8_t bandOfChannel(uint8_t channel);
+  
+  // Bandın görev döngüsü böleni (1 / oran; bölge planından)
+  static uint16_t dutyDivider(uint8_t band);
+  
+private:
+  uint32_t availableAt[DUTY_CYCLE_BANDS];
+  uint32_t airtimeTotal[DUTY_CYCLE_BANDS];
+  bool used[DUTY_CYCLE_BANDS];
+};
+
+#endif // DUTY_CYCLE_LEDGER_H
@@ -0,0 +1,37 @@
+#ifndef EVENT_TRACE_H
+#define EVENT_TRACE_H
+
+#include <Arduino.h>
+#include <lmic.h>
+#include "../Config/AppConfig.h"
+#include "../Utils/Utils.h"
+#include "EventTraceFormat.h"
+
+// LMIC olay izi kaydedici
+//
+// LoraManager::handleEvent'e gelen her olayda zaman damgası ve LMIC durumu
+// (opmode, frekans, veri hızı, rxtime, txend) sabit boyutlu halka tampona
+// yazılır; tampon dolunca en eski kayıt ezilir. İz tek seferde ikili olarak
+// dökülür ve host tarafında tools/trace_view ile zaman çizelgesine çevrilir.
+class EventTrace {
+public:
+  EventTrace();
+
+  // LMIC'in o anki durumunu olayla birlikte kaydet
+  void record(ev_t ev);
+
+  // Başlık + kayıtları (eskiden yeniye) tek seferde yaz
+  void dump(Print& out) const;
+
+  void clear();
+
+  uint16_t count() const;
+
+private:
+  TraceRecord records[EVENT_TRACE_CAPACITY];
+  uint16_t next;         // Sonraki yazılacak indeks
+  uint16_t size;         // Geçerli kayıt sayısı
+  uint32_t overwritten;
+};
+
+#endif // EVENT_TRACE_H
@@ -0,0 +1,41 @@
+#ifndef EVENT_TRACE_FORMAT_H
+#define EVENT_TRACE_FORMAT_H
+
+// LMIC olay izinin ikili döküm biçimi
+//
+// Yalnızca <stdint.h> kullanır; aynı başlık cihazda (EventTrace) ve host
+// tarafındaki zaman çizelgesi aracında (tools/trace_view.cpp) kullanılır.
+// Düzen değişirse TRACE_DUMP_VERSION artırılmalıdır.
+
+#include <stdint.h>
+
+#define TRACE_DUMP_MAGIC    0x31435254UL  // "TRC1" (küçük endian)
+#define TRACE_DUMP_VERSION  1
+
+// onEvent anında LMIC durumunun anlık görüntüsü (28 byte)
+struct TraceRecord {
+  uint32_t timestampMs;  // Utils::getTimestamp()
+  int32_t osTime;        // os_getTime() (tick)
+  int32_t rxtime;        // LMIC.rxtime: son RX penceresinin açılış zamanı (tick)
+  int32_t txend;         // LMIC.txend: son iletimin bitişi (tick)
+  uint32_t freq;         // LMIC.freq (Hz)
+  uint16_t opmode;       // LMIC.opmode
+  uint8_t ev;            // ev_t
+  uint8_t datarate;      // LMIC.datarate
+  uint8_t txrxFlags;     // LMIC.txrxFlags
+  uint8_t dataLen;       // LMIC.dataLen
+  uint8_t rxDelay;       // LMIC.rxDelay (sn)
+  uint8_t rxsyms;        // LMIC.rxsyms
+};
+
+// Döküm başlığı; ardından count adet TraceRecord eskiden yeniye sıralı gelir
+struct TraceDumpHeader {
+  uint32_t magic;
+  uint8_t version;
+  uint8_t recordSize;
+  uint16_t count;
+  uint32_t osTicksPerSec;  // Tick -> süre dönüşümü için
+  uint32_t overwritten;    // Tampon dolduğu için üzerine yazılan en eski kayıt sayısı
+};
+
+#endif // EVENT_TRACE_FORMAT_H
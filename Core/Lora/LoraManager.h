@@ -5,14 +5,68 @@
 #include <lmic.h>
 #include <hal/hal.h>
 #include <SPI.h>
+#include <atomic>
 #include "../Config/AppConfig.h"
 #include "../Utils/Utils.h"
+#include "../Utils/SpscQueue.h"
+#include "../Utils/EventBus.h"
+#include "../Utils/PayloadView.h"
+#include "../Display/DisplayProxy.h"
+#include "DutyCycleLedger.h"
+#include "EventTrace.h"
+#include "RegionPlan.h"
+#include "SessionStore.h"
+#include "RxCalibration.h"
+#include "RadioProfile.h"
 
-// Forward declaration
-class DisplayManager;
+// handleEvent anında kopyalanan olay kaydı; geri çağırmalar LMIC bağlamının
+// dışında, LoraManager::loop() içinde bu kayıtla sırayla çağrılır
+struct LoraEvent {
+  uint32_t timestamp;      // Utils::getTimestamp()
+  uint8_t ev;              // ev_t
+  uint8_t txrxFlags;       // Olay anındaki LMIC.txrxFlags (TXRX_ACK vb.)
+  uint8_t port;            // Downlink FPort (yoksa 0)
+  uint8_t dataLen;         // Downlink uygulama yükü uzunluğu
+  bool success;            // TXCOMPLETE: true, TXCANCELED: false
+  uint16_t frameSeq;       // Olay anındaki gönderim sayısı (LMIC.frame hâlâ bu downlink'i tutuyor mu)
+  const uint8_t* data;     // LMIC.frame içindeki downlink yükü (kopyalanmaz); yalnızca
+                           // geri çağırma süresince ve yeni uplink başlatılana kadar geçerli
+  
+  PayloadView payload() const { return PayloadView(data, dataLen); }
+};
+
+// FPort'lu downlink işleyicisi; yük LMIC.frame içindeki görünümdür
+typedef void (*LoraDownlinkHandler)(void* context, uint8_t port, PayloadView payload);
+
+// Ertelenmiş olay kuyruğu sayaçları
+struct LoraEventQueueStats {
+  uint32_t dispatched;       // Geri çağırmalara teslim edilen olay
+  uint32_t dropped;          // Kuyruk dolu olduğu için kaybolan olay
+  uint32_t staleDownlinks;   // Teslimden önce yeni gönderim LMIC.frame'i ezdiği için yükü atılan downlink
+  uint16_t pending;          // Teslim bekleyen olay
+  uint16_t maxDepth;         // Görülen en yüksek kuyruk derinliği
+};
+
+// Olay aboneliği: işleyici (bağlam, olay) ile çağrılır, maske ev_t bitleridir
+typedef EventBus<LoraEvent, LORA_EVENT_SUBSCRIBERS> LoraEventBus;
+typedef LoraEventBus::Handler LoraEventHandler;
 
-typedef void (*LoraEventCallback)(ev_t event);
-typedef void (*LoraTxCompleteCallback)(bool success);
+#define LORA_EVENT_MASK(ev)   (1UL << (ev))
+#define LORA_EVENTS_TX_DONE   (LORA_EVENT_MASK(EV_TXCOMPLETE) | LORA_EVENT_MASK(EV_TXCANCELED))
+#define LORA_EVENTS_JOIN      (LORA_EVENT_MASK(EV_JOINING) | LORA_EVENT_MASK(EV_JOINED) | \
+                               LORA_EVENT_MASK(EV_JOIN_FAILED) | LORA_EVENT_MASK(EV_JOIN_TXCOMPLETE))
+// LMIC'teki bekleyen iletim sonuç olayı gelmeden düşer: sıfırlama, bağlantı
+// kaybı veya yeniden join (LoraManager her join denemesinde LMIC_reset yapar)
+#define LORA_EVENTS_LINK_LOST (LORA_EVENT_MASK(EV_RESET) | LORA_EVENT_MASK(EV_LINK_DEAD) | \
+                               LORA_EVENT_MASK(EV_JOINING))
+#define LORA_EVENTS_ALL       0xFFFFFFFFUL
+
+// Join durum makinesi durumları
+enum JoinState : uint8_t {
+  JOIN_IDLE,          // Ağa katılmış, join işlemi yok
+  JOIN_IN_PROGRESS,   // LMIC join isteğini yürütüyor
+  JOIN_BACKOFF        // Sonraki denemeden önce geri çekilme süresi bekleniyor
+};
 
 class LoraManager {
 public:
@@ -24,28 +78,152 @@ public:
   // Veri gönderme fonksiyonu
   bool sendData(uint8_t* data, uint8_t size, uint8_t port = 1, bool confirmed = false);
   
-  // Olay işleme fonksiyonlarını ayarlama
-  void setEventCallback(LoraEventCallback callback);
-  void setTxCompleteCallback(LoraTxCompleteCallback callback);
+  // Geçerli veri hızı ve bölgeye göre azami uygulama yükü (byte)
+  uint8_t getMaxPayloadSize() const;
+  
+  // Olaylara abone ol; her bileşen kendi maskesi ve bağlamıyla bağımsız kaydolur.
+  // İşleyiciler loop() içinde, LMIC bağlamının dışında çağrılır.
+  bool subscribe(uint32_t eventMask, LoraEventHandler handler, void* context);
+  bool unsubscribe(LoraEventHandler handler, void* context);
+  
+  // FPort'lu downlink'lerin işleyicisi (tek). EV_TXCOMPLETE abonelerinden önce
+  // çağrılır; böylece bir abonenin başlattığı uplink yükü okunmadan ezemez
+  void setDownlinkHandler(LoraDownlinkHandler handler, void* context);
+  
+  // Ertelenmiş olay kuyruğu sayaçları
+  LoraEventQueueStats getEventQueueStats() const;
   
   // Cihaz durumunu alma
   bool isJoined() const;
   lmic_t* getLMIC();
   
+  // TX sürüyor veya bir RX penceresine yakın olunuyor mu; bu sürede
+  // ekran çizimi gibi bloklayan işler ertelenmelidir
+  bool isRadioCritical();
+  
+  // Alt bant görev döngüsü defteri
+  DutyCycleLedger& getDutyCycleLedger();
+  
+  // Son LMIC olaylarının izi (TRACE_DUMP)
+  EventTrace& getEventTrace();
+  
+  // RX penceresi zamanlama ölçümleri ve uygulanan saat hatası
+  const RxCalibration& getRxCalibration() const;
+  
+  // LMIC parametrelerinin hedef profili ve sunucu kaynaklı değişiklik sayaçları
+  RadioProfile& getRadioProfile();
+  
+  // Uyunabilir mi: ağa katılmış, TX/RX/join yok, teslim veya yazma bekleyen iş yok
+  bool isIdle() const;
+  
+  // En erken LMIC işine kalan süre (ms); horizonMs içinde iş yoksa horizonMs
+  uint32_t msUntilNextJob(uint32_t horizonMs);
+  
+  // Derin uyku öncesi LMIC durumunu RTC belleğine kaydet ve radyoyu uyut;
+  // sleepMs uyandıktan sonra zamanlayıcıların kaydırılması için gerekir
+  void suspend(uint32_t sleepMs);
+  
+  // Kayıtlı oturumu sil ve yeniden OTAA join başlat (REJOIN komutu).
+  // Yalnızca istek bırakır; iş bir sonraki loop() turunda radyo tarafında yapılır.
+  void forgetSession();
+  
   // Ekran yöneticisini ayarla
   void setDisplayManager(DisplayManager* display);
   
+  // Radyo tarafından kuyruğa alınan ekran komutlarını uygula, ekranı çiz ve
+  // log kayıtlarını yaz. Tek çekirdekte loop() sonunda çağrılır; DUAL_CORE_MODE
+  // ile ekranın ve Serial'ın sahibi olan UI görevi çağırmalıdır.
+  void serviceUi(bool radioBusy = false);
+  
 private:
   // Durum değişkenleri
   bool joined;
   uint32_t lastJoinAttempt;
   
-  // Geri çağırma işlevi işaretçileri
-  LoraEventCallback eventCallback;
-  LoraTxCompleteCallback txCompleteCallback;
+  // TX başladığında LMIC.txend değeri; değiştiğinde TX bitmiş demektir
+  bool txInFlight;
+  ostime_t txEndAtStart;
+  
+  // Her iletimin yayın süresini alt bant başına tutar
+  DutyCycleLedger dutyCycle;
+  
+  // handleEvent'e gelen olayların LMIC anlık görüntüleri
+  EventTrace eventTrace;
+  
+  // Ölçülen saat hatasına göre RX penceresini daraltır
+  RxCalibration rxCalibration;
+  
+  // rxDelay, RX2 ve veri hızı gibi parametrelerin hedef değerleri
+  RadioProfile radioProfile;
+  
+  // Ekran çağrıları doğrudan değil, bu kuyruk üzerinden yapılır
+  DisplayProxy displayProxy;
+  
+  // Join durum makinesi
+  JoinState joinState;
+  uint32_t joinStateSince;
+  uint32_t joinBackoffMs;
+  uint32_t firstJoinTime;
+  uint8_t joinAttempts;
+  
+  // Kalıcı oturum (DevAddr, anahtarlar, sayaçlar); yeniden açılışta join'i atlar
+  SessionStore sessionStore;
+  LoraSession savedSession;
+  LoraSessionCounters sessionCounters;
+  bool sessionDirty;     // Yeni join: oturum kaydı yazılmalı
+  bool countersDirty;    // DevNonce veya FCnt kaydı yazılmalı
+  std::atomic<bool> rejoinRequested;
+  
+  // Olay aboneleri
+  LoraEventBus eventBus;
+  
+  // Ekran komutlarının uygulandığı yönetici (yoksa ekran komutu üretilmez)
+  DisplayManager* displayManager;
+  
+  // handleEvent (üretici) -> dispatchEvents (tüketici) kuyruğu
+  SpscQueue<LoraEvent, LORA_EVENT_QUEUE_CAPACITY> eventQueue;
+  uint32_t eventsDispatched;
+  uint16_t eventQueueMaxDepth;
+  
+  // Downlink yükü LMIC.frame'den okunur; frame her gönderimde yeniden yazıldığı
+  // için EV_TXSTART sayısıyla geçerliliği denetlenir
+  LoraDownlinkHandler downlinkHandler;
+  void* downlinkContext;
+  uint16_t txFrameSeq;
+  uint32_t staleDownlinks;
+  
+  // Olayı kuyruğa al (LMIC bağlamı); downlink yükü yerinde bırakılır
+  void enqueueEvent(ev_t ev);
+  
+  // Bekleyen olayları sırayla geri çağırmalara teslim et (uygulama bağlamı)
+  void dispatchEvents();
+  
+  // LMIC_reset, ardından kanal planı ve RX/veri hızı parametreleri
+  void resetRadio();
+  
+  // Saat hatası ve RX/veri hızı parametrelerini uygula (sıfırlama ve join sonrası)
+  void applyRadioConfig();
+  
+  // Derin uykudan uyanıldıysa RTC'deki LMIC durumunu geri yükle
+  bool resumeFromSleep();
+  
+  // Kayıtlı oturumu LMIC'e yükle; başarılıysa join gerekmez
+  bool restoreSession();
+  
+  // Değişen oturum/sayaç kayıtlarını toplu olarak yaz (radyo boştayken)
+  void persistSession();
+  
+  // Kayıtlı DevNonce'u LMIC'e verip OTAA join başlat
+  void startJoin();
+  
+  // Join durum makinesini zamana bağlı olarak ilerlet (bloklamaz)
+  void updateJoinState();
+  void enterJoinState(JoinState state);
+  uint32_t nextJoinBackoff() const;
   
-  // LMIC olay işleme işlevi
-  static void onEvent(ev_t ev);
+  // LMIC olay işleme (LMIC_registerEventCb ile bu nesneye bağlanır)
+  static void onLmicEvent(void* userData, ev_t ev);
+  void handleEvent(ev_t ev);
 };
 
 #endif // LORA_MANAGER_H 
\ No newline at end of file
@@ -0,0 +1,61 @@
+#ifndef LOW_POWER_H
+#define LOW_POWER_H
+
+#include <Arduino.h>
+#include "../Config/AppConfig.h"
+#include "../Utils/ProfileHistogram.h"
+#include "../Display/DisplayManager.h"
+#include "LoraManager.h"
+
+// Bir sonraki uyanmaya kadar yapılacak uyku
+struct SleepPlan {
+  uint32_t durationMs;  // 0: şu an uyunamaz
+  bool deep;            // true: derin uyku (RAM kaybolur, LMIC durumu RTC'den geri yüklenir)
+};
+
+// Uyku döngüsü sayaçları; ESP32'de RTC belleğinde tutulur, derin uykuda korunur
+struct SleepStats {
+  uint32_t cycles;
+  uint32_t deepCycles;
+  uint32_t lastAwakeMs;
+  uint32_t totalAwakeMs;
+  uint32_t totalSleepMs;
+  ProfileHistogram awake;   // Döngü başına uyanık kalma süresi (ms)
+};
+
+// Düşük güç çalışma modu
+//
+// plan() bir sonraki uyanma zamanını uygulamanın gönderim zamanından, görev
+// döngüsü defterinden (bant kapalıyken uyanmak boşunadır) ve LMIC iş
+// kuyruğundan hesaplar. LMIC'te zamanlanmış iş yoksa ve uygulama RAM'de
+// bekleyen veri tutmuyorsa derin uyku seçilir: LMIC durumu RTC belleğine
+// kaydedilir, ekran ve radyo kapatılır ve açılışta join yapılmadan devam
+// edilir. Aksi halde hafif uyku (RAM ve LMIC zamanlayıcısı korunur) ile en
+// erken işe kadar beklenir.
+class LowPower {
+public:
+  // appWakeAt: uygulamanın bir sonraki işi (Utils::getTimestamp() cinsinden, mutlak).
+  // appIdle: uygulama kuyruklarında derin uykuda kaybolacak veri yok
+  static SleepPlan plan(LoraManager& manager, uint32_t appWakeAt, bool appIdle);
+
+  // Planı uygula. Derin uykuda geri dönmez (cihaz setup()'tan başlar); hafif
+  // uykudan sonra ekran eski durumuna getirilir
+  static void sleep(LoraManager& manager, DisplayManager* display, const SleepPlan& plan);
+
+  // Açılış derin uykudan zamanlayıcı ile mi oldu
+  static bool wokeFromDeepSleep();
+
+  static const SleepStats& getStats();
+
+  // Döngü sayısı, uyanık kalma p50/p99/max ve uyanık oranı
+  static void printReport(Print& out);
+
+  static void resetStats();
+
+private:
+  static uint32_t awakeSince;
+
+  static void recordCycle(uint32_t awakeMs, uint32_t sleepMs, bool deep);
+};
+
+#endif // LOW_POWER_H
@@ -0,0 +1,71 @@
+#ifndef RADIO_PROFILE_H
+#define RADIO_PROFILE_H
+
+#include <Arduino.h>
+#include <lmic.h>
+#include "../Config/AppConfig.h"
+
+// Profilin yönettiği LMIC parametreleri (sıra LOG_RADIO_DRIFT kayıtlarında kullanılır)
+enum RadioParam : uint8_t {
+  RADIO_PARAM_RX_DELAY = 0,   // LMIC.rxDelay (RXTimingSetup)
+  RADIO_PARAM_RX1_DR_OFFSET,  // LMIC.rx1DrOffset (RXParamSetup)
+  RADIO_PARAM_RX2_DR,         // LMIC.dn2Dr (RXParamSetup)
+  RADIO_PARAM_RX2_FREQ,       // LMIC.dn2Freq (RXParamSetup)
+  RADIO_PARAM_DATARATE,       // LMIC.datarate (LinkADRReq)
+  RADIO_PARAM_TX_POWER,       // LMIC.adrTxPow (LinkADRReq)
+  RADIO_PARAM_COUNT
+};
+
+// Profil ile ağ sunucusu arasındaki sapma sayaçları
+struct RadioProfileStats {
+  uint32_t checks;                          // Downlink sonrası yapılan karşılaştırma
+  uint32_t accepted[RADIO_PARAM_COUNT];     // Sunucu değişikliği kabul edildi
+  uint32_t reverted[RADIO_PARAM_COUNT];     // Profil değeri geri yazıldı
+};
+
+// LMIC radyo parametrelerinin hedef profili
+//
+// Parametreler LMIC_reset ve join sonrası birer kez yazılır. LMIC bu alanları
+// yalnızca alınan downlink'teki MAC komutlarıyla değiştirebildiği için sapma
+// her döngüde değil, downlink'ten sonra son uygulanan değerlerle tek bir
+// karşılaştırmayla aranır. Her parametre için AppConfig'teki RADIO_POLICY_*
+// kimin kazanacağını belirler: RADIO_POLICY_SERVER ise sunucunun değeri kabul
+// edilir ve profil yalnızca başlangıç değeridir; RADIO_POLICY_PROFILE ise
+// profil değeri geri yazılır.
+class RadioProfile {
+public:
+  RadioProfile();
+
+  // LMIC_reset sonrası: tüm parametreler profil değerine yazılır
+  void applyReset();
+
+  // Join veya oturum geri yükleme sonrası: yalnızca profilin kazandığı
+  // parametreler yazılır; diğerleri join-accept'ten/oturumdan gelen değerde kalır
+  void applyJoined();
+
+  // Downlink sonrası (MAC komutları işlenmiş). Sunucunun bir değişikliği
+  // kabul edildiyse true döner (oturum kaydı güncellenmeli)
+  bool checkDrift();
+
+  // Hedef değeri değiştir ve hemen uygula (ör. downlink komutuyla veri hızı)
+  void set(RadioParam param, int32_t value);
+
+  int32_t target(RadioParam param) const;
+
+  const RadioProfileStats& getStats() const;
+
+  void printReport(Print& out) const;
+
+private:
+  int32_t targets[RADIO_PARAM_COUNT];
+  int32_t applied[RADIO_PARAM_COUNT];   // Son yazılan/kabul edilen LMIC değeri
+  RadioProfileStats stats;
+
+  static const uint8_t kPolicy[RADIO_PARAM_COUNT];
+
+  static int32_t read(RadioParam param);
+  static void write(RadioParam param, int32_t value);
+  void snapshot();
+};
+
+#endif // RADIO_PROFILE_H
@@ -0,0 +1,51 @@
+#ifndef RADIO_TASK_H
+#define RADIO_TASK_H
+
+#include <Arduino.h>
+#include "../Config/AppConfig.h"
+#include "LoraManager.h"
+
+#if !defined(ESP32)
+#include <atomic>
+#include <thread>
+#endif
+
+// Her radyo turunda LoraManager::loop()'tan sonra çağrılır (ör. MessageService::loop)
+typedef void (*RadioServiceHook)(void* context);
+
+// Çift çekirdekli çalışma modeli (DUAL_CORE_MODE)
+//
+// LMIC çalışma döngüsü ve LoraManager, RADIO_TASK_CORE çekirdeğine
+// sabitlenmiş yüksek öncelikli bir FreeRTOS görevinde döner. LMIC'e dokunan
+// her şey (MessageService dahil) bu görevden hook ile çağrılmalıdır. Ekran
+// ve Serial diğer çekirdekteki Arduino loop()'ta kalır ve
+// LoraManager::serviceUi() ile radyo tarafının kuyruklarını tüketir.
+// ESP32 dışında (host derlemesi) aynı tasarım std::thread ile çalışır.
+class RadioTask {
+public:
+  // Görevi başlat; LoraManager::setup() önceden çağrılmış olmalıdır
+  static bool start(LoraManager* manager, RadioServiceHook hook = nullptr, void* context = nullptr);
+
+  static bool isRunning();
+
+#if !defined(ESP32)
+  // Host testleri için görevi durdur ve bitmesini bekle
+  static void stop();
+#endif
+
+private:
+  static LoraManager* manager;
+  static RadioServiceHook hook;
+  static void* hookContext;
+
+  static void run(void* parameter);
+
+#if defined(ESP32)
+  static TaskHandle_t handle;
+#else
+  static std::thread thread;
+  static std::atomic<bool> stopRequested;
+#endif
+};
+
+#endif // RADIO_TASK_H
@@ -0,0 +1,263 @@
+#ifndef REGION_PLAN_H
+#define REGION_PLAN_H
+
+// Bölge ve kanal planı tabloları
+//
+// Her bölge için kanallar, veri hızı aralıkları, azami yükler, RX2
+// varsayılanları ve görev döngüsü bantları derleme zamanında sabit
+// tablolardır. Bölge, LMIC'in CFG_* derleme bayrağından seçilir; başka
+// bölgeye geçmek için kod değil yalnızca bu bayrak değişir. Tüm tablolar
+// her derlemede static_assert ile doğrulanır, Region::apply() seçili planı
+// LMIC'e uygular ve Region::validate() LMIC'in durumunu tabloyla karşılaştırır.
+//
+// Azami yükler LoRaWAN Regional Parameters (RP002-1.0.3) tablolarındaki
+// tekrarlayıcı uyumlu (repeater-compatible) N değerleridir (FOpts boş).
+// 0 değeri o bölgede tanımsız/RFU veri hızını belirtir. Veri hızları ve
+// bant indeksleri bölgeden bağımsız sayısal değerlerdir (DR0 = 0).
+
+#include <stdint.h>
+
+#define REGION_MAX_BANDS 4   // LMIC EU868 bant sayısı (MILLI, CENTI, DECI, AUX)
+
+// Plandaki tek kanal
+struct RegionChannel {
+  uint8_t index;        // LMIC kanal numarası
+  uint32_t frequency;   // Hz
+  uint8_t minDr;
+  uint8_t maxDr;
+  uint8_t band;         // RegionPlan::bands indeksi
+};
+
+// Görev döngüsü bandı
+struct RegionBand {
+  uint16_t dutyDivider; // 1 / oran (ör. %1 -> 100); 1: sınır yok
+};
+
+struct RegionPlan {
+  const char* name;
+  uint32_t minFrequency;          // Bölgenin frekans aralığı (Hz)
+  uint32_t maxFrequency;
+  const RegionChannel* channels;
+  uint8_t channelCount;
+  uint8_t channelSlots;           // LMIC kanal tablosu boyu
+  uint8_t defaultChannels;        // LMIC_reset'in kurduğu, değiştirilemeyen kanallar
+  const uint8_t* maxPayload;      // Veri hızı başına azami uygulama yükü
+  uint8_t dataRateCount;
+  uint32_t rx2Frequency;
+  uint8_t rx2Dr;
+  const RegionBand* bands;
+  uint8_t bandCount;
+  int8_t maxEirpDbm;
+};
+
+namespace Region {
+
+// ---- EU868 ----
+// Bant sırası LMIC'in EU868 bant indeksleriyle aynıdır (LMIC_setupChannel'a olduğu gibi verilir)
+static constexpr RegionBand kEu868Bands[] = {
+  { 1000 },  // BAND_MILLI %0.1
+  { 100 },   // BAND_CENTI %1
+  { 10 },    // BAND_DECI  %10
+  { 100 },   // BAND_AUX
+};
+static constexpr RegionChannel kEu868Channels[] = {
+  { 0, 868100000, 0, 5, 1 },
+  { 1, 868300000, 0, 5, 1 },
+  { 2, 868500000, 0, 5, 1 },
+  { 3, 867100000, 0, 5, 1 },
+  { 4, 867300000, 0, 5, 1 },
+  { 5, 867500000, 0, 5, 1 },
+  { 6, 867700000, 0, 5, 1 },
+  { 7, 867900000, 0, 5, 1 },
+  { 8, 868800000, 7, 7, 0 },  // FSK
+};
+//                                        DR0 DR1 DR2 DR3  DR4  DR5  DR6  DR7
+static constexpr uint8_t kEu868Payload[] = { 51, 51, 51, 115, 222, 222, 222, 222 };
+
+static constexpr RegionPlan kEU868 = {
+  "EU868", 863000000, 870000000,
+  kEu868Channels, sizeof(kEu868Channels) / sizeof(kEu868Channels[0]), 16, 3,
+  kEu868Payload, sizeof(kEu868Payload),
+  869525000, 0,
+  kEu868Bands, sizeof(kEu868Bands) / sizeof(kEu868Bands[0]),
+  16
+};
+
+// ---- US915 ----
+// Sabit 72 kanal; ağ sunucularının çoğunun kullandığı 2. alt bant (8-15 ve 65)
+static constexpr RegionBand kUs915Bands[] = { { 1 } };
+static constexpr RegionChannel kUs915Channels[] = {
+  { 8,  903900000, 0, 3, 0 },
+  { 9,  904100000, 0, 3, 0 },
+  { 10, 904300000, 0, 3, 0 },
+  { 11, 904500000, 0, 3, 0 },
+  { 12, 904700000, 0, 3, 0 },
+  { 13, 904900000, 0, 3, 0 },
+  { 14, 905100000, 0, 3, 0 },
+  { 15, 905300000, 0, 3, 0 },
+  { 65, 904600000, 4, 4, 0 },  // 500 kHz
+};
+//                                        DR0 DR1 DR2  DR3  DR4  DR5 DR6 DR7 DR8 DR9  DR10 DR11 DR12 DR13
+static constexpr uint8_t kUs915Payload[] = { 11, 53, 125, 242, 242, 0,  0,  0,  33, 109, 222, 222, 222, 222 };
+
+static constexpr RegionPlan kUS915 = {
+  "US915", 902000000, 928000000,
+  kUs915Channels, sizeof(kUs915Channels) / sizeof(kUs915Channels[0]), 72, 0,
+  kUs915Payload, sizeof(kUs915Payload),
+  923300000, 8,
+  kUs915Bands, 1,
+  30
+};
+
+// ---- AS923 (AS923-1, dwell time kısıtlaması yok) ----
+static constexpr RegionBand kAs923Bands[] = { { 100 } };
+static constexpr RegionChannel kAs923Channels[] = {
+  { 0, 923200000, 0, 5, 0 },
+  { 1, 923400000, 0, 5, 0 },
+  { 2, 922200000, 0, 5, 0 },
+  { 3, 922400000, 0, 5, 0 },
+  { 4, 922600000, 0, 5, 0 },
+  { 5, 922800000, 0, 5, 0 },
+  { 6, 923000000, 0, 5, 0 },
+  { 7, 922000000, 0, 5, 0 },
+};
+//                                        DR0 DR1 DR2 DR3  DR4  DR5  DR6  DR7
+static constexpr uint8_t kAs923Payload[] = { 51, 51, 51, 115, 222, 222, 222, 222 };
+
+static constexpr RegionPlan kAS923 = {
+  "AS923", 915000000, 928000000,
+  kAs923Channels, sizeof(kAs923Channels) / sizeof(kAs923Channels[0]), 16, 2,
+  kAs923Payload, sizeof(kAs923Payload),
+  923200000, 2,
+  kAs923Bands, 1,
+  16
+};
+
+// ---- KR920 (LBT; görev döngüsü sınırı yok) ----
+static constexpr RegionBand kKr920Bands[] = { { 1 } };
+static constexpr RegionChannel kKr920Channels[] = {
+  { 0, 922100000, 0, 5, 0 },
+  { 1, 922300000, 0, 5, 0 },
+  { 2, 922500000, 0, 5, 0 },
+  { 3, 922700000, 0, 5, 0 },
+  { 4, 922900000, 0, 5, 0 },
+  { 5, 923100000, 0, 5, 0 },
+  { 6, 923300000, 0, 5, 0 },
+};
+//                                        DR0 DR1 DR2 DR3  DR4  DR5
+static constexpr uint8_t kKr920Payload[] = { 51, 51, 51, 115, 222, 222 };
+
+static constexpr RegionPlan kKR920 = {
+  "KR920", 920900000, 923300000,
+  kKr920Channels, sizeof(kKr920Channels) / sizeof(kKr920Channels[0]), 16, 3,
+  kKr920Payload, sizeof(kKr920Payload),
+  921900000, 0,
+  kKr920Bands, 1,
+  14
+};
+
+// ---- IN866 (görev döngüsü sınırı yok) ----
+static constexpr RegionBand kIn866Bands[] = { { 1 } };
+static constexpr RegionChannel kIn866Channels[] = {
+  { 0, 865062500, 0, 5, 0 },
+  { 1, 865402500, 0, 5, 0 },
+  { 2, 865985000, 0, 5, 0 },
+};
+//                                        DR0 DR1 DR2 DR3  DR4  DR5  DR6 DR7
+static constexpr uint8_t kIn866Payload[] = { 51, 51, 51, 115, 222, 222, 0,  222 };
+
+static constexpr RegionPlan kIN866 = {
+  "IN866", 865000000, 867000000,
+  kIn866Channels, sizeof(kIn866Channels) / sizeof(kIn866Channels[0]), 16, 3,
+  kIn866Payload, sizeof(kIn866Payload),
+  866550000, 2,
+  kIn866Bands, 1,
+  30
+};
+
+// ---- Derleme zamanı doğrulama ----
+
+constexpr bool frequencyValid(const RegionPlan& p, uint32_t frequency) {
+  return frequency >= p.minFrequency && frequency <= p.maxFrequency;
+}
+
+constexpr bool dataRateValid(const RegionPlan& p, uint8_t datarate) {
+  return datarate < p.dataRateCount && p.maxPayload[datarate] != 0;
+}
+
+constexpr bool channelValid(const RegionPlan& p, const RegionChannel& c) {
+  return c.index < p.channelSlots && frequencyValid(p, c.frequency) &&
+         c.minDr <= c.maxDr && dataRateValid(p, c.minDr) && dataRateValid(p, c.maxDr) &&
+         c.band < p.bandCount;
+}
+
+// i. kanalın LMIC numarası sonraki kanallarda tekrar edilmiyor
+constexpr bool indexUnique(const RegionPlan& p, uint8_t i, uint8_t j) {
+  return j >= p.channelCount ? true :
+         (p.channels[i].index != p.channels[j].index && indexUnique(p, i, j + 1));
+}
+
+// Tüm kanallar geçerli ve her LMIC kanal numarası bir kez kullanılmış
+constexpr bool channelsValid(const RegionPlan& p, uint8_t i = 0) {
+  return i >= p.channelCount ? true :
+         (channelValid(p, p.channels[i]) && indexUnique(p, i, i + 1) && channelsValid(p, i + 1));
+}
+
+constexpr bool planValid(const RegionPlan& p) {
+  return p.channelCount > 0 && p.channelCount <= p.channelSlots &&
+         p.bandCount > 0 && p.bandCount <= REGION_MAX_BANDS &&
+         frequencyValid(p, p.rx2Frequency) && dataRateValid(p, p.rx2Dr) &&
+         channelsValid(p);
+}
+
+static_assert(planValid(kEU868), "EU868 planı geçersiz");
+static_assert(planValid(kUS915), "US915 planı geçersiz");
+static_assert(planValid(kAS923), "AS923 planı geçersiz");
+static_assert(planValid(kKR920), "KR920 planı geçersiz");
+static_assert(planValid(kIN866), "IN866 planı geçersiz");
+
+// ---- Seçili bölge ----
+
+#if defined(CFG_us915)
+constexpr const RegionPlan& current() { return kUS915; }
+#elif defined(CFG_as923)
+constexpr const RegionPlan& current() { return kAS923; }
+#elif defined(CFG_kr920)
+constexpr const RegionPlan& current() { return kKR920; }
+#elif defined(CFG_in866)
+constexpr const RegionPlan& current() { return kIN866; }
+#elif defined(CFG_eu868)
+constexpr const RegionPlan& current() { return kEU868; }
+#else
+// Tablosu olmayan bölge (ör. CFG_au915) EU868'e düşürülmez: yanlış frekans ve güç
+#error "Seçili CFG_* bölgesi için RegionPlan tablosu yok"
+#endif
+
+// Veri hızı için azami uygulama yükü (tanımsız veri hızında 0)
+constexpr uint8_t maxPayload(uint8_t datarate) {
+  return datarate < current().dataRateCount ? current().maxPayload[datarate] : 0;
+}
+
+// Bölgedeki en küçük tanımlı sınır (tüm veri hızlarında güvenli boyut)
+constexpr uint8_t minPayload(uint8_t index = 0, uint8_t best = 255) {
+  return index >= current().dataRateCount ? best :
+         minPayload(index + 1, (current().maxPayload[index] != 0 && current().maxPayload[index] < best) ?
+                                current().maxPayload[index] : best);
+}
+
+// Bandın görev döngüsü böleni (tanımsız bantta 1)
+constexpr uint16_t dutyDivider(uint8_t band) {
+  return band < current().bandCount ? current().bands[band].dutyDivider : 1;
+}
+
+// Seçili planın kanallarını ve kanal maskesini LMIC'e uygula ve doğrula.
+// Yalnızca LMIC_reset()'ten sonra çağrılır; join sonrası kanallar join-accept'in
+// CFList'inden gelir. RX2 değerleri RadioProfile'dan yazılır
+bool apply();
+
+// LMIC'in kanal tablosu plana uyuyor mu; uymayan her kanal LOG_REGION_MISMATCH ile kaydedilir
+bool validate();
+
+} // namespace Region
+
+#endif // REGION_PLAN_H
@@ -0,0 +1,86 @@
+#ifndef RX_CALIBRATION_H
+#define RX_CALIBRATION_H
+
+#include <Arduino.h>
+#include <lmic.h>
+#include "../Config/AppConfig.h"
+#include "Airtime.h"
+
+#define RX_CAL_MAX_WINDOWS         2   // Uplink başına RX1 + RX2
+#define LORAWAN_JOIN_ACCEPT_DELAY1 5   // Saniye (tüm bölgelerde JOIN_ACCEPT_DELAY1)
+
+// RX zamanlama kalibrasyonu sayaçları
+struct RxCalibrationStats {
+  uint32_t samples;          // Ölçülen downlink/join-accept sayısı
+  uint32_t misses;           // Beklenen ama alınamayan yanıt (NACK, join-accept yok)
+  int32_t lastOffsetUs;      // Son ölçüm: gerçek - beklenen önsöz başlangıcı
+  uint32_t meanAbsOffsetUs;  // |sapma| hareketli ortalaması
+  uint32_t maxAbsOffsetUs;
+  uint32_t clockErrorPpm;    // LMIC'e uygulanan saat hatası
+  uint32_t uplinks;          // RX süresi ölçülen uplink sayısı
+  uint32_t lastRxOnUs;       // Son uplink'in RX pencerelerinde geçen süre
+  uint32_t meanRxOnUs;       // Uplink başına RX süresi hareketli ortalaması
+  bool calibrated;
+};
+
+// Kendini ayarlayan RX penceresi zamanlaması
+//
+// Sabit %40 saat hatası ve rxsyms = 50 her uplink'te radyoyu gereğinden uzun
+// RX'te tutar. Bu sınıf her alınan downlink ve join-accept için önsözün
+// gerçek başlangıcını (RxDone anı - çerçeve yayın süresi) TX bitişi + RX
+// gecikmesiyle karşılaştırır ve sapmanın gecikmeye oranından saat hatasını
+// tahmin eder. RX_CAL_MIN_SAMPLES ölçümden sonra LMIC_setClockError bu
+// tahminin RX_CAL_MARGIN katıyla ayarlanır; LMIC pencereyi ve rxsyms'i buna
+// göre kendisi daraltır. Art arda RX_CAL_MAX_MISSES kaçırılan yanıtta geniş
+// (CLOCK_ERROR_PERCENTAGE) ayara dönülür ve kalibrasyon yeniden başlar.
+class RxCalibration {
+public:
+  RxCalibration();
+
+  // EV_TXSTART: bu uplink join isteği mi (beklenen gecikme ve çerçeve boyu)
+  void onTxStart(bool joining);
+
+  // EV_RXSTART: pencere açılışı, sembol sayısı ve sembol süresi kaydedilir
+  void onRxStart();
+
+  // Uplink sonucu (EV_TXCOMPLETE, EV_JOINED, EV_JOIN_TXCOMPLETE).
+  // received: pencerelerden birinde çerçeve alındı; missed: yanıt beklenip gelmedi
+  void onUplinkDone(bool received, bool missed);
+
+  // Geçerli saat hatasını LMIC'e uygula
+  void apply() const;
+
+  // MAX_CLOCK_ERROR ölçeğinde saat hatası (kalibre değilse geniş varsayılan)
+  uint16_t clockError() const;
+
+  const RxCalibrationStats& getStats() const;
+
+  void printReport(Print& out) const;
+
+private:
+  struct RxWindow {
+    ostime_t start;
+    rps_t rps;                // Pencerenin veri hızı (alınan çerçevenin yayın süresi için)
+    uint32_t timeoutUs;       // rxsyms * sembol süresi
+  };
+
+  RxCalibrationStats stats;
+  RxWindow windows[RX_CAL_MAX_WINDOWS];
+  uint8_t windowCount;
+  bool joinUplink;
+  uint32_t rx1DelayMs;        // TX bitişinden RX1'e nominal süre
+  uint8_t calibrationSamples; // Son sıfırlamadan beri ölçüm
+  uint8_t consecutiveMisses;
+  uint32_t peakPpm;           // Yavaşça azalan en büyük ölçülen saat hatası
+
+  void addSample(int32_t offsetUs, uint32_t delayMs);
+  void reset();
+
+  // Alınan çerçevenin PHY boyu (byte)
+  uint8_t receivedFrameLength() const;
+
+  // Pencere rps değerinden downlink yayın parametreleri
+  static LoraTxParams downlinkParams(rps_t rps);
+};
+
+#endif // RX_CALIBRATION_H
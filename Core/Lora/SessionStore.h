@@ -0,0 +1,94 @@
+#ifndef SESSION_STORE_H
+#define SESSION_STORE_H
+
+#include <Arduino.h>
+#include <lmic.h>
+#include <stddef.h>
+#include "../Config/AppConfig.h"
+
+#if defined(ESP32)
+#include <Preferences.h>
+#endif
+
+#define SESSION_MAGIC    0x3153534CUL  // "LSS1" (küçük endian)
+#define SESSION_VERSION  1
+
+// Join ile oluşan, seyrek değişen oturum bilgisi (DevAddr, anahtarlar, kanal/ADR)
+struct LoraSession {
+  uint32_t magic;
+  uint8_t version;
+  uint8_t datarate;
+  int8_t txPower;           // LMIC.adrTxPow
+  uint8_t adrEnabled;
+  uint32_t netId;
+  uint32_t devAddr;
+  uint8_t nwkSKey[16];
+  uint8_t appSKey[16];
+  uint32_t dn2Freq;
+  uint8_t dn2Dr;
+  uint8_t rx1DrOffset;
+  uint8_t rxDelay;
+  uint8_t reserved;
+#if CFG_LMIC_EU_like
+  uint32_t channelFreq[MAX_CHANNELS];
+  uint16_t channelDrMap[MAX_CHANNELS];
+#endif
+  uint8_t channelMap[sizeof(lmic_t::channelMap)];
+  uint32_t checksum;
+};
+
+// Her uplink'te değişen sayaçlar; oturumdan ayrı ve küçük tutulur ki
+// sık yazma yalnızca bu kaydı etkilesin
+struct LoraSessionCounters {
+  uint32_t magic;
+  uint32_t seqnoUp;         // Son kayıttaki FCntUp (geri yüklemede ileri atlanır)
+  uint32_t seqnoDn;
+  uint16_t devNonce;        // Sonraki join isteğinde kullanılabilecek en küçük değer
+  uint16_t reserved;
+  uint32_t checksum;
+};
+
+// LoRaWAN oturumunun kalıcı deposu
+//
+// ESP32'de NVS (Preferences), host derlemesinde SESSION_STORE_PATH önekli
+// iki dosya kullanılır. Kayıtlar sağlama toplamıyla doğrulanır; bozuk veya
+// farklı sürümlü kayıt yok sayılır ve cihaz normal OTAA join'e döner.
+// Yazma sayısını sınırlamak LoraManager'ın işidir (bkz. SESSION_FCNT_SAVE_INTERVAL).
+class SessionStore {
+public:
+  SessionStore();
+
+  bool begin();
+
+  bool loadSession(LoraSession& session);
+  bool saveSession(LoraSession& session);
+
+  bool loadCounters(LoraSessionCounters& counters);
+  bool saveCounters(LoraSessionCounters& counters);
+
+  // Oturumu sil; sayaçlar (DevNonce) yeni join için korunur
+  void clearSession();
+
+  // LMIC'in o anki oturumunu kayda kopyala / kayıttan LMIC'e uygula
+  static void capture(LoraSession& session);
+  static void restore(const LoraSession& session);
+
+  // Açılıştan beri yapılan kalıcı yazma sayısı
+  uint32_t getWrites() const;
+
+private:
+  bool opened;
+  uint32_t writes;
+
+#if defined(ESP32)
+  Preferences prefs;
+#endif
+
+  bool read(const char* key, void* data, size_t size);
+  bool write(const char* key, const void* data, size_t size);
+  void remove(const char* key);
+
+  static uint32_t checksum(const void* data, size_t size);
+};
+
+#endif // SESSION_STORE_H
@@ -0,0 +1,100 @@
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Sabit kapasiteli, yığın (heap) kullanmayan çok aboneli olay dağıtıcı
+//
+// Aboneler olay türü maskesi (bit i = tür i), işleyici ve bağlam işaretçisi
+// ile kaydolur. Kayıt sırasında her tür için ilgilenen abonelerin bit
+// haritası hesaplanır; publish() yalnızca o haritadaki abonelere gider,
+// yani maske taraması yerine türe göre indeksli bir çağrıdır. Aboneler
+// yuva sırasıyla (boşalan yuva yeniden kullanılır) çağrılır. Yalnızca
+// <stdint.h> kullanır.
+template <typename Event, uint8_t Capacity>
+class EventBus {
+public:
+  typedef void (*Handler)(void* context, const Event& event);
+
+  static_assert(Capacity <= 16, "abone haritası 16 bit");
+
+  EventBus() : used(0) {
+    for (uint8_t i = 0; i < 32; i++) {
+      routes[i] = 0;
+    }
+  }
+
+  // Aboneliği ekle; kapasite doluysa veya aynı (işleyici, bağlam) zaten kayıtlıysa false
+  bool subscribe(uint32_t typeMask, Handler handler, void* context) {
+    if (!handler || typeMask == 0 || find(handler, context) >= 0) {
+      return false;
+    }
+    for (uint8_t slot = 0; slot < Capacity; slot++) {
+      if (used & (1u << slot)) {
+        continue;
+      }
+      subscribers[slot].handler = handler;
+      subscribers[slot].context = context;
+      used |= (1u << slot);
+      for (uint8_t type = 0; type < 32; type++) {
+        if (typeMask & (1UL << type)) {
+          routes[type] |= (1u << slot);
+        }
+      }
+      return true;
+    }
+    return false;
+  }
+
+  bool unsubscribe(Handler handler, void* context) {
+    int slot = find(handler, context);
+    if (slot < 0) {
+      return false;
+    }
+    used &= ~(1u << slot);
+    for (uint8_t type = 0; type < 32; type++) {
+      routes[type] &= ~(1u << slot);
+    }
+    return true;
+  }
+
+  // Olayı türüne abone olan işleyicilere teslim et
+  void publish(uint8_t type, const Event& event) const {
+    if (type >= 32) {
+      return;
+    }
+    uint16_t pending = routes[type];
+    while (pending) {
+      uint8_t slot = __builtin_ctz(pending);
+      pending &= pending - 1;
+      subscribers[slot].handler(subscribers[slot].context, event);
+    }
+  }
+
+  uint8_t count() const {
+    return __builtin_popcount(used);
+  }
+
+private:
+  struct Subscriber {
+    Handler handler;
+    void* context;
+  };
+
+  Subscriber subscribers[Capacity];
+  uint16_t used;          // Dolu abone yuvaları
+  uint16_t routes[32];    // Tür -> abone yuvası bit haritası
+
+  int find(Handler handler, void* context) const {
+    for (uint8_t slot = 0; slot < Capacity; slot++) {
+      if ((used & (1u << slot)) && subscribers[slot].handler == handler &&
+          subscribers[slot].context == context) {
+        return slot;
+      }
+    }
+    return -1;
+  }
+};
+
+#endif // EVENT_BUS_H
@@ -0,0 +1,84 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <Arduino.h>
+#include "../Config/AppConfig.h"
+
+// Derleme zamanı seviyeli log
+//
+// LORA_DEBUG_LEVEL altında kalan seviyeler derleme zamanında elenir:
+//
+//   LOG_INFO(F("Bant: "), Region::current().name);
+//
+// LORA_DEBUG_LEVEL 1 ile derlendiğinde bu satır sabit false bir koşulun
+// arkasında kalır; argümanlar değerlendirilmez, F() metinleri flash'a girmez
+// ve Log::Sink<false> boş olduğu için Serial çağrısı da üretilmez.
+
+#define LOG_LEVEL_NONE   0  // Tüm çıktı kapalı
+#define LOG_LEVEL_ERROR  1  // Yalnızca hatalar (üretim)
+#define LOG_LEVEL_INFO   2  // Durum değişiklikleri
+#define LOG_LEVEL_DEBUG  3  // Detaylı radyo/zamanlama bilgisi
+
+namespace Log {
+
+// Seviye derlenen seviyede etkin mi
+constexpr bool enabled(uint8_t level) {
+  return level != LOG_LEVEL_NONE && level <= LORA_DEBUG_LEVEL;
+}
+
+template <bool Enabled>
+struct Sink {
+  static inline void write() {}
+
+  template <typename T, typename... Rest>
+  static inline void write(const T& value, const Rest&... rest) {
+    Serial.print(value);
+    write(rest...);
+  }
+
+  template <typename... Args>
+  static inline void line(const Args&... args) {
+    write(args...);
+    Serial.println();
+  }
+
+  template <typename Label>
+  static inline void hex(const Label& label, const uint8_t* buffer, size_t size) {
+    Serial.print(label);
+    for (size_t i = 0; i < size; i++) {
+      if (buffer[i] < 0x10) {
+        Serial.print('0');
+      }
+      Serial.print(buffer[i], HEX);
+    }
+    Serial.println();
+  }
+};
+
+// Elenen seviyeler: Serial'a hiçbir referans kalmaz
+template <>
+struct Sink<false> {
+  template <typename... Args>
+  static inline void write(const Args&...) {}
+
+  template <typename... Args>
+  static inline void line(const Args&...) {}
+
+  template <typename Label>
+  static inline void hex(const Label&, const uint8_t*, size_t) {}
+};
+
+} // namespace Log
+
+// Sabit koşul, argümanların yalnızca etkin seviyede değerlendirilmesini sağlar
+#define LOG_AT(level, ...) \
+  do { if (Log::enabled(level)) { Log::Sink<Log::enabled(level)>::line(__VA_ARGS__); } } while (0)
+
+#define LOG_HEX_AT(level, label, buffer, size) \
+  do { if (Log::enabled(level)) { Log::Sink<Log::enabled(level)>::hex((label), (buffer), (size)); } } while (0)
+
+#define LOG_ERROR(...) LOG_AT(LOG_LEVEL_ERROR, __VA_ARGS__)
+#define LOG_INFO(...)  LOG_AT(LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_DEBUG(...) LOG_AT(LOG_LEVEL_DEBUG, __VA_ARGS__)
+
+#endif // LOG_H
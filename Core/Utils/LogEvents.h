@@ -0,0 +1,195 @@
+#ifndef LOG_EVENTS_H
+#define LOG_EVENTS_H
+
+// İkili log kayıtlarının tanımı
+//
+// Yalnızca <stdint.h> kullanır; aynı başlık cihazda (LogRing) ve host
+// tarafındaki çözücüde (tools/log_decode.cpp) kullanılır. Yeni olay
+// eklerken yalnızca listenin sonuna ekleyin, kLogArgCounts ve kLogFormats
+// tablolarını aynı sırayla güncelleyin; mevcut kimlikler değişmemelidir.
+//
+// Metin tabloları (kLogFormats, kLmicEventNames) ve formatLogRecord yalnızca
+// LOG_EVENTS_TEXT 1 iken derlenir. Cihazda bu LOG_OUTPUT_BINARY 0 demektir;
+// üretim seviyesinde (LORA_DEBUG_LEVEL 1) kayıtlar ikili gider, etiket ve
+// argüman adları flash'a girmez ve çözme tools/log_decode ile host'ta yapılır.
+// AppConfig.h olmadan derlenen host araçlarında tablolar her zaman vardır.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define LOG_RECORD_ARGS   4
+#define LOG_SYNC_BYTE     0xA5   // İkili çıktıda her kaydın önündeki eşitleme byte'ı
+
+#if !defined(LOG_OUTPUT_BINARY) || !LOG_OUTPUT_BINARY
+#define LOG_EVENTS_TEXT   1
+#else
+#define LOG_EVENTS_TEXT   0
+#endif
+
+enum LogEventId : uint8_t {
+  LOG_LMIC_EVENT = 0,   // ev, opmode, joined
+  LOG_TX_ACK,           //
+  LOG_DOWNLINK,         // dataLen, port
+  LOG_DOWNLINK_BYTES,   // ham byte'lar (argc = byte sayısı)
+  LOG_JOIN_RX_PARAMS,   // rxDelay, rx1DrOffset, rxsyms, dn2Dr
+  LOG_JOIN_TX_FREQ,     // freq
+  LOG_RX_ACTIVE,        // opmode, freq, dataLen
+  LOG_RX_DATA_BYTES,    // ham byte'lar (argc = byte sayısı)
+  LOG_STATUS,           // opmode, rxDelay, dn2Dr, joined
+  LOG_JOIN_WAIT,        // opmode, rxtime, now, delta (tick)
+  LOG_RX1_PASSED,       //
+  LOG_RX2_PASSED,       //
+  LOG_RX2_PENDING,      //
+  LOG_RX2_DR_SET,       // dn2Dr
+  LOG_RX_PARAMS,        // rxDelay, rx1DrOffset, dn2Dr
+  LOG_PARAM_FORCED,     // parametre (0: rxDelay, 1: rx1DrOffset, 2: dn2Dr), yeni değer (eski sürümler; yerine LOG_RADIO_DRIFT)
+  LOG_JOIN_RETRY,       // stalled (1) / zaman aşımı (0), geri çekilme (ms)
+  LOG_JOIN_RESTART,     // deneme sayısı
+  LOG_SEND_REJECTED,    // neden (0: ağa bağlı değil, 1: işlem sürüyor, 2: yük büyük), sınır
+  LOG_SEND_QUEUED,      // port, boyut, onaylı
+  LOG_MSG_REJECTED,     // neden (0: metin boş/uzun, 1: kuyruk dolu, 2: veri büyük, 3: veri hızına sığmıyor), boyut, sınır
+  LOG_MSG_QUEUED,       // port, boyut, kuyruk derinliği
+  LOG_MSG_TX_RESULT,    // başarılı, sonucu düşüren olay (ev_t; yoksa 0)
+  LOG_SESSION_RESTORED, // devAddr, seqnoUp, seqnoDn, devNonce
+  LOG_SESSION_SAVED,    // oturum yazıldı, seqnoUp, devNonce, toplam yazma
+  LOG_SLEEP_CYCLE,      // uyanık (ms), uyku (ms), derin, döngü
+  LOG_SLEEP_RESUMED,    // devAddr, seqnoUp
+  LOG_RX_CALIBRATION,   // sapma (us), saat hatası (ppm), RX süresi (us), alındı
+  LOG_REGION_MISMATCH,  // kanal, plandaki frekans, LMIC frekansı, etkin
+  LOG_RADIO_DRIFT,      // parametre (RadioParam), LMIC değeri, önceki değer, kabul edildi
+  LOG_DOWNLINK_UNROUTED, // port, boyut
+  LOG_DOWNLINK_COMMAND, // işlem kodu, başarılı, argüman boyutu
+  LOG_EVENT_COUNT
+};
+
+// Tek bir log kaydı (24 byte, ikili çıktıda olduğu gibi gönderilir)
+struct LogRecord {
+  uint32_t timestamp;   // ms
+  uint8_t id;           // LogEventId
+  uint8_t argc;         // Argüman sayısı; *_BYTES kayıtlarında byte sayısı
+  uint16_t reserved;
+  union {
+    int32_t args[LOG_RECORD_ARGS];
+    uint8_t bytes[LOG_RECORD_ARGS * 4];
+  };
+};
+
+// Kayıt başına argüman sayısı; LogRing::push argc'yi buradan alır ve tablo
+// ikili çıktıda da cihazda kalır. *_BYTES kayıtlarında 0 (argc = byte sayısı)
+static constexpr uint8_t kLogArgCounts[LOG_EVENT_COUNT] = {
+  3, 0, 2, 0, 4, 1, 3, 0, 4, 4, 0, 0, 0, 1, 3, 2,
+  2, 1, 2, 3, 3, 3, 2, 4, 4, 4, 2, 4, 4, 4, 2, 3,
+};
+
+#if LOG_EVENTS_TEXT
+
+// Kayıtları okunur metne çevirmek için biçim tablosu
+struct LogFormat {
+  const char* label;
+  const char* argNames[LOG_RECORD_ARGS];
+  uint8_t hexMask;      // Bit i set ise argüman i onaltılık yazılır
+  bool rawBytes;        // Argümanlar yerine ham byte dizisi
+};
+
+static constexpr LogFormat kLogFormats[LOG_EVENT_COUNT] = {
+  { "LoRa Olayı",                    { "ev", "opmode", "joined", nullptr }, 0x02, false },
+  { "ACK alındı",                    { nullptr, nullptr, nullptr, nullptr }, 0x00, false },
+  { "Veri alındı",                   { "len", "port", nullptr, nullptr }, 0x00, false },
+  { "Alınan veri (HEX)",             { nullptr, nullptr, nullptr, nullptr }, 0x00, true },
+  { "JOIN TX sonrası RX ayarları",   { "rxDelay", "rx1DrOffset", "rxsyms", "dn2Dr" }, 0x00, false },
+  { "RXMODE ayarlandı",              { "freq", nullptr, nullptr, nullptr }, 0x00, false },
+  { "RX Modu Aktif",                 { "opmode", "freq", "dataLen", nullptr }, 0x01, false },
+  { "RX Data",                       { nullptr, nullptr, nullptr, nullptr }, 0x00, true },
+  { "LMIC durumu",                   { "opmode", "rxDelay", "dn2Dr", "joined" }, 0x01, false },
+  { "JOIN TX sonrası bekleme",       { "opmode", "rxtime", "now", "rx1Kalan" }, 0x01, false },
+  { "RX1 penceresi açık veya geçti", { nullptr, nullptr, nullptr, nullptr }, 0x00, false },
+  { "RX2 penceresi de geçti",        { nullptr, nullptr, nullptr, nullptr }, 0x00, false },
+  { "RX2 penceresi hazırlanıyor/açık", { nullptr, nullptr, nullptr, nullptr }, 0x00, false },
+  { "RX2 SF ayarlandı",              { "dn2Dr", nullptr, nullptr, nullptr }, 0x00, false },
+  { "RX ayarları",                   { "rxDelay", "rx1DrOffset", "dn2Dr", nullptr }, 0x00, false },
+  { "Parametre düzeltildi",          { "param", "value", nullptr, nullptr }, 0x00, false },
+  { "JOIN yeniden deneme",           { "stalled", "backoffMs", nullptr, nullptr }, 0x00, false },
+  { "OTAA JOIN tekrar başlatıldı",   { "attempt", nullptr, nullptr, nullptr }, 0x00, false },
+  { "Veri gönderilemiyor",           { "reason", "limit", nullptr, nullptr }, 0x00, false },
+  { "Paket kuyruğa alındı",          { "port", "size", "confirmed", nullptr }, 0x00, false },
+  { "Mesaj reddedildi",              { "reason", "size", "limit", nullptr }, 0x00, false },
+  { "Mesaj kuyruğa alındı",          { "port", "size", "depth", nullptr }, 0x00, false },
+  { "Mesaj gönderim sonucu",         { "success", "event", nullptr, nullptr }, 0x00, false },
+  { "Oturum geri yüklendi",          { "devAddr", "seqnoUp", "seqnoDn", "devNonce" }, 0x01, false },
+  { "Oturum kaydedildi",             { "session", "seqnoUp", "devNonce", "writes" }, 0x00, false },
+  { "Uykuya geçiliyor",              { "awakeMs", "sleepMs", "deep", "cycle" }, 0x00, false },
+  { "Derin uykudan devam edildi",    { "devAddr", "seqnoUp", nullptr, nullptr }, 0x01, false },
+  { "RX zamanlaması",                { "offsetUs", "ppm", "rxOnUs", "received" }, 0x00, false },
+  { "Kanal planına uymuyor",         { "ch", "planFreq", "lmicFreq", "enabled" }, 0x00, false },
+  { "Radyo parametresi değişti",     { "param", "value", "previous", "accepted" }, 0x00, false },
+  { "Downlink işleyicisi yok",       { "port", "len", nullptr, nullptr }, 0x00, false },
+  { "Downlink komutu",               { "opcode", "ok", "argLen", nullptr }, 0x01, false },
+};
+
+// Adı olan argüman sayısı kLogArgCounts ile aynı olmalı (derleme zamanında denetlenir)
+constexpr uint8_t logArgNameCount(const LogFormat& format, uint8_t i = 0) {
+  return i < LOG_RECORD_ARGS && format.argNames[i] ? logArgNameCount(format, i + 1) : i;
+}
+
+constexpr bool logArgCountsMatch(uint8_t id = 0) {
+  return id >= LOG_EVENT_COUNT ||
+         (logArgNameCount(kLogFormats[id]) == kLogArgCounts[id] && logArgCountsMatch(id + 1));
+}
+
+static_assert(logArgCountsMatch(), "kLogArgCounts, kLogFormats argüman adlarıyla uyuşmuyor");
+
+// LMIC ev_t değerlerinin adları (indeks = ev_t)
+static const char* const kLmicEventNames[] = {
+  "?", "SCAN_TIMEOUT", "BEACON_FOUND", "BEACON_MISSED", "BEACON_TRACKED",
+  "JOINING", "JOINED", "RFU1", "JOIN_FAILED", "REJOIN_FAILED", "TXCOMPLETE",
+  "LOST_TSYNC", "RESET", "RXCOMPLETE", "LINK_DEAD", "LINK_ALIVE", "SCAN_FOUND",
+  "TXSTART", "TXCANCELED", "RXSTART", "JOIN_TXCOMPLETE"
+};
+
+static const uint8_t kLmicEventNameCount = sizeof(kLmicEventNames) / sizeof(kLmicEventNames[0]);
+
+// Kaydı okunur metne çevir: "[zaman] etiket: ad=değer ..."
+// Cihaz ve host çözücü aynı işlevi kullanır; çıktı sonundaki satır sonu dahil değildir.
+inline size_t formatLogRecord(const LogRecord& record, char* buffer, size_t size) {
+  if (size == 0) return 0;
+  
+  int n;
+  if (record.id >= LOG_EVENT_COUNT) {
+    n = snprintf(buffer, size, "[%lu] Bilinmeyen kayıt %u", (unsigned long)record.timestamp, record.id);
+    return n < 0 ? 0 : ((size_t)n < size ? (size_t)n : size - 1);
+  }
+  
+  const LogFormat& fmt = kLogFormats[record.id];
+  n = snprintf(buffer, size, "[%lu] %s", (unsigned long)record.timestamp, fmt.label);
+  size_t used = n < 0 ? 0 : ((size_t)n < size ? (size_t)n : size - 1);
+  
+  if (fmt.rawBytes) {
+    uint8_t count = record.argc > sizeof(record.bytes) ? sizeof(record.bytes) : record.argc;
+    for (uint8_t i = 0; i < count && used < size - 1; i++) {
+      n = snprintf(buffer + used, size - used, "%s%02X", i == 0 ? ": " : " ", record.bytes[i]);
+      used += n < 0 ? 0 : ((size_t)n < size - used ? (size_t)n : size - used - 1);
+    }
+    return used;
+  }
+  
+  for (uint8_t i = 0; i < record.argc && i < LOG_RECORD_ARGS && used < size - 1; i++) {
+    const char* name = fmt.argNames[i] ? fmt.argNames[i] : "arg";
+    const char* sep = i == 0 ? ": " : ", ";
+    int32_t value = record.args[i];
+    
+    if (record.id == LOG_LMIC_EVENT && i == 0 && value >= 0 && value < kLmicEventNameCount) {
+      n = snprintf(buffer + used, size - used, "%s%s", sep, kLmicEventNames[value]);
+    } else if (fmt.hexMask & (1 << i)) {
+      n = snprintf(buffer + used, size - used, "%s%s=0x%lX", sep, name, (unsigned long)(uint32_t)value);
+    } else {
+      n = snprintf(buffer + used, size - used, "%s%s=%ld", sep, name, (long)value);
+    }
+    used += n < 0 ? 0 : ((size_t)n < size - used ? (size_t)n : size - used - 1);
+  }
+  
+  return used;
+}
+
+#endif // LOG_EVENTS_TEXT
+
+#endif // LOG_EVENTS_H
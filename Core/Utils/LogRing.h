@@ -0,0 +1,48 @@
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+#include <Arduino.h>
+#include "../Config/AppConfig.h"
+#include "Utils.h"
+#include "Log.h"
+#include "LogEvents.h"
+#include "SpscQueue.h"
+
+// Radyo yolundan ertelenmiş ikili log hattı
+//
+// Radyo zamanlamasına duyarlı kod (onEvent, LoraManager::loop) Serial'a
+// yazmak yerine kompakt kayıtları (olay kimliği, zaman damgası, argümanlar)
+// kilitsiz tek üretici/tek tüketici halka tampona ekler. Biçimlendirme ve
+// UART çıkışı flush() ile düşük öncelikli bir noktada yapılır; flush() UART
+// TX tamponunda yer yoksa durur, hiçbir zaman bloklamaz. Tampon doluysa
+// yeni kayıt atılır ve sayılır.
+class LogRing {
+public:
+  // Kayıt ekle (üretici tarafı)
+  static bool push(uint8_t id, int32_t a0 = 0, int32_t a1 = 0, int32_t a2 = 0, int32_t a3 = 0);
+  static bool pushArgs(uint8_t id, uint8_t argc, int32_t a0, int32_t a1, int32_t a2, int32_t a3);
+  
+  // Ham byte dizisini (ör. downlink verisi) gerektiği kadar kayda bölerek ekle
+  static void pushBytes(uint8_t id, const uint8_t* data, uint8_t length);
+  
+  // En fazla maxRecords kaydı çıkışa yaz (tüketici tarafı); yazılan kayıt sayısı döner
+  static uint16_t flush(Print& out, uint16_t maxRecords = LOG_FLUSH_BUDGET);
+  
+  // Bekleyen kayıt sayısı
+  static uint16_t pending();
+  
+  // Tampon dolu olduğu için atılan kayıt sayısı
+  static uint32_t getDropped();
+  
+private:
+  static SpscQueue<LogRecord, LOG_RING_CAPACITY> ring;
+};
+
+// Seviyeli kayıt; LORA_DEBUG_LEVEL altındaki kayıtlar derlemeden elenir
+#define LOG_RECORD(level, id, ...) \
+  do { if (Log::enabled(level)) { LogRing::push((id), ##__VA_ARGS__); } } while (0)
+
+#define LOG_RECORD_BYTES(level, id, data, length) \
+  do { if (Log::enabled(level)) { LogRing::pushBytes((id), (data), (length)); } } while (0)
+
+#endif // LOG_RING_H
@@ -0,0 +1,96 @@
+#ifndef PAYLOAD_VIEW_H
+#define PAYLOAD_VIEW_H
+
+// Sahip olmayan, sınır denetimli yük görünümü
+//
+// Downlink yükünü LMIC.frame içinde kopyalamadan okumak için kullanılır.
+// Görünüm yalnızca işaretçi ve uzunluk tutar; belleğin ömrünü çağıran
+// belirler. Sıralı okumalarda sınır aşılırsa hata bayrağı kalıcı olarak
+// kurulur ve 0 döner, böylece ayrıştırıcı her okumadan sonra değil sonunda
+// bir kez hasError() ile denetleyebilir. Çok byte'lı alanlar big-endian'dır.
+//
+// Yalnızca <stdint.h> kullanır; host tarafında da derlenebilir.
+
+#include <stdint.h>
+
+class PayloadView {
+public:
+  PayloadView() : buf(nullptr), len(0), pos(0), error(false) {
+  }
+
+  PayloadView(const uint8_t* data, uint8_t length) :
+    buf(data), len(data ? length : 0), pos(0), error(false) {
+  }
+
+  const uint8_t* data() const { return buf; }
+  uint8_t size() const { return len; }
+  bool empty() const { return len == 0; }
+
+  // Rastgele erişim; sınır dışında 0
+  uint8_t at(uint8_t index) const {
+    return index < len ? buf[index] : 0;
+  }
+
+  // Alt görünüm; aralık sınırı aşıyorsa boş görünüm
+  PayloadView slice(uint8_t offset, uint8_t length) const {
+    if (offset > len || length > len - offset) {
+      return PayloadView();
+    }
+    return PayloadView(buf + offset, length);
+  }
+
+  uint8_t readU8() {
+    if (pos >= len) {
+      error = true;
+      return 0;
+    }
+    return buf[pos++];
+  }
+
+  uint16_t readU16() {
+    if (remaining() < 2) {
+      error = true;
+      pos = len;
+      return 0;
+    }
+    uint16_t value = ((uint16_t)buf[pos] << 8) | buf[pos + 1];
+    pos += 2;
+    return value;
+  }
+
+  uint32_t readU32() {
+    if (remaining() < 4) {
+      error = true;
+      pos = len;
+      return 0;
+    }
+    uint32_t value = ((uint32_t)buf[pos] << 24) | ((uint32_t)buf[pos + 1] << 16) |
+                     ((uint32_t)buf[pos + 2] << 8) | buf[pos + 3];
+    pos += 4;
+    return value;
+  }
+
+  // Sıradaki length byte'ın görünümü (kopyalamaz)
+  PayloadView readView(uint8_t length) {
+    if (remaining() < length) {
+      error = true;
+      pos = len;
+      return PayloadView();
+    }
+    PayloadView view(buf + pos, length);
+    pos += length;
+    return view;
+  }
+
+  uint8_t remaining() const { return len - pos; }
+  bool atEnd() const { return pos >= len; }
+  bool hasError() const { return error; }
+
+private:
+  const uint8_t* buf;
+  uint8_t len;
+  uint8_t pos;
+  bool error;
+};
+
+#endif // PAYLOAD_VIEW_H
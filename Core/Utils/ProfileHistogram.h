@@ -0,0 +1,96 @@
+#ifndef PROFILE_HISTOGRAM_H
+#define PROFILE_HISTOGRAM_H
+
+// Gecikme histogramı ve ikili döküm biçimi
+//
+// Yalnızca <stdint.h> kullanır; aynı başlık cihazda (Profiler) ve host
+// tarafındaki karşılaştırma aracında (tools/profile_compare.cpp) kullanılır.
+// Yeni kapsam eklerken yalnızca listenin sonuna ekleyin; mevcut kimlikler ve
+// döküm düzeni değişirse PROFILE_DUMP_VERSION artırılmalıdır.
+//
+// Kovalar logaritmiktir: her ikinin kuvveti aralığı iki alt kovaya bölünür
+// (ör. 64-95 ve 96-127 döngü). Böylece 1 döngüden ~1 saniyeye kadar her
+// değer %50'den daha iyi çözünürlükle, kapsam başına 224 byte'ta tutulur.
+
+#include <stdint.h>
+
+#define PROFILE_BUCKETS       56     // 28 oktav x 2 alt kova (240 MHz'de ~1.1 sn'ye kadar)
+#define PROFILE_DUMP_MAGIC    0x31465250UL  // "PRF1" (küçük endian)
+#define PROFILE_DUMP_VERSION  1
+
+// Ölçülen kapsamlar (kimlikler ikili dökümün parçasıdır, sırası değişmemeli)
+enum ProfileScopeId : uint8_t {
+  PROF_LOOP = 0,        // LoraManager::loop() turunun tamamı
+  PROF_RUNLOOP,         // os_runloop_once()
+  PROF_RENDER,          // DisplayManager::renderNow()
+  PROF_ON_EVENT,        // LoraManager::handleEvent()
+  PROF_SERIAL_COMMAND,  // Seri komut işleme
+  PROF_LORA_RECEIVE,    // Gelen LoRa paketinin okunması ve gösterimi
+  PROF_SCOPE_COUNT
+};
+
+static const char* const kProfileScopeNames[PROF_SCOPE_COUNT] = {
+  "loop", "runloop", "render", "onEvent", "serialCmd", "loraRx"
+};
+
+// Tek kapsamın histogramı; ikili dökümde bu yapı olduğu gibi yazılır.
+// Değerlerin birimi histogramın sahibine aittir: Profiler kapsamlarında CPU
+// döngüsü (Profiler::cyclesToUs ile µs), LowPower'ın uyanık süresinde ms
+struct ProfileHistogram {
+  uint32_t count;
+  uint32_t maxValue;        // Görülen en büyük değer (kovalarla aynı birim)
+  uint32_t buckets[PROFILE_BUCKETS];
+};
+
+// Döküm başlığı; ardından scopeCount adet ProfileHistogram gelir
+struct ProfileDumpHeader {
+  uint32_t magic;
+  uint8_t version;
+  uint8_t scopeCount;
+  uint8_t bucketCount;
+  uint8_t cpuMhz;       // Döngüleri mikrosaniyeye çevirmek için
+  uint32_t uptimeMs;
+};
+
+namespace ProfileBuckets {
+
+// Değerin düştüğü kova
+inline uint8_t indexOf(uint32_t value) {
+  if (value < 2) {
+    return (uint8_t)value;
+  }
+  uint8_t octave = 31 - __builtin_clz(value);
+  uint8_t index = octave * 2 + ((value >> (octave - 1)) & 1);
+  return index < PROFILE_BUCKETS ? index : PROFILE_BUCKETS - 1;
+}
+
+// Kovanın kapsadığı en büyük değer
+inline uint32_t upperBound(uint8_t index) {
+  if (index < 2) {
+    return index;
+  }
+  uint8_t octave = index / 2;
+  uint32_t half = 1UL << (octave - 1);
+  return (1UL << octave) + (index & 1) * half + half - 1;
+}
+
+// Yüzdelik değeri (histogramın biriminde); kova üst sınırı ölçülen maksimumla kırpılır
+inline uint32_t percentile(const ProfileHistogram& histogram, uint8_t percent) {
+  if (histogram.count == 0) {
+    return 0;
+  }
+  uint32_t rank = (uint32_t)(((uint64_t)histogram.count * percent + 99) / 100);
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i < PROFILE_BUCKETS; i++) {
+    seen += histogram.buckets[i];
+    if (seen >= rank) {
+      uint32_t bound = upperBound(i);
+      return bound < histogram.maxValue ? bound : histogram.maxValue;
+    }
+  }
+  return histogram.maxValue;
+}
+
+} // namespace ProfileBuckets
+
+#endif // PROFILE_HISTOGRAM_H
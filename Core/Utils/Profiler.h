@@ -0,0 +1,62 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include "../Config/AppConfig.h"
+#include "Utils.h"
+#include "ProfileHistogram.h"
+
+// Sıcak yol süre ölçümü
+//
+// PROFILE_SCOPE(PROF_RUNLOOP); satırı bulunduğu bloğun süresini CPU döngü
+// sayacıyla ölçer ve kapsamın histogramına ekler. PROFILER_ENABLED 0 ile
+// derlendiğinde makro boş kalır; ölçüm noktalarında hiçbir kod üretilmez.
+class Profiler {
+public:
+  // CPU döngü sayacı (ESP32 dışında mikrosaniye)
+  static inline uint32_t now() {
+#if defined(ESP32)
+    return ESP.getCycleCount();
+#else
+    return micros();
+#endif
+  }
+
+  // Bir ölçümü kapsamın histogramına ekle
+  static void record(uint8_t scope, uint32_t cycles);
+
+  // Kapsam başına adet, p50, p99 ve maksimum (µs) yazdır
+  static void printReport(Print& out);
+
+  // Başlık + histogramları ikili olarak yaz (tools/profile_compare ile karşılaştırılır)
+  static void dump(Print& out);
+
+  static void reset();
+
+  static const ProfileHistogram& getHistogram(uint8_t scope);
+
+  // Döngü sayısını mikrosaniyeye çevir
+  static uint32_t cyclesToUs(uint32_t cycles);
+
+private:
+  static ProfileHistogram histograms[PROF_SCOPE_COUNT];
+};
+
+// Blok sonunda süreyi kaydeden yardımcı
+class ProfileScope {
+public:
+  explicit ProfileScope(uint8_t scope) : scope(scope), start(Profiler::now()) {}
+  ~ProfileScope() { Profiler::record(scope, Profiler::now() - start); }
+
+private:
+  uint8_t scope;
+  uint32_t start;
+};
+
+#if PROFILER_ENABLED
+#define PROFILE_SCOPE(scope) ProfileScope profileScope_##scope(scope)
+#else
+#define PROFILE_SCOPE(scope) do {} while (0)
+#endif
+
+#endif // PROFILER_H
@@ -0,0 +1,90 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+// Sınırlı, kilitsiz tek üretici/tek tüketici kuyruk
+//
+// Bir görev yalnızca push(), diğeri yalnızca front()/pop() çağırır; bu
+// koşulla çekirdekler (veya std::thread'ler) arasında kilit ya da kesme
+// kapatma gerekmez. Kapasite N-1 elemandır (bir yuva dolu/boş ayrımı için
+// boş kalır). Kuyruk doluysa push() bekletmez, false döner ve sayar.
+// Yalnızca <atomic> kullanır; cihazda ve host derlemesinde aynıdır.
+template <typename T, uint16_t N>
+class SpscQueue {
+public:
+  SpscQueue() : head(0), tail(0), dropped(0) {}
+
+  // Üretici tarafı
+  bool push(const T& item) {
+    uint16_t h = head.load(std::memory_order_relaxed);
+    uint16_t next = (h + 1) % N;
+
+    if (next == tail.load(std::memory_order_acquire)) {
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    items[h] = item;
+    head.store(next, std::memory_order_release);
+    return true;
+  }
+
+  // Tüketici tarafı: sıradaki eleman (boşsa nullptr); pop() çağrılana kadar geçerli
+  const T* front() const {
+    uint16_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) {
+      return nullptr;
+    }
+    return &items[t];
+  }
+
+  void pop() {
+    uint16_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) {
+      return;
+    }
+    tail.store((t + 1) % N, std::memory_order_release);
+  }
+
+  // Tüketici tarafı: sıradakini kopyala ve çıkar
+  bool pop(T& item) {
+    const T* next = front();
+    if (!next) {
+      return false;
+    }
+    item = *next;
+    pop();
+    return true;
+  }
+
+  // Her iki taraftan da çağrılabilir; anlık görüntüdür
+  uint16_t size() const {
+    uint16_t h = head.load(std::memory_order_acquire);
+    uint16_t t = tail.load(std::memory_order_acquire);
+    return (h + N - t) % N;
+  }
+
+  bool isEmpty() const {
+    return size() == 0;
+  }
+
+  static constexpr uint16_t capacity() {
+    return N - 1;
+  }
+
+  // Kuyruk dolu olduğu için reddedilen eleman sayısı
+  uint32_t getDropped() const {
+    return dropped.load(std::memory_order_relaxed);
+  }
+
+private:
+  T items[N];
+  std::atomic<uint16_t> head;   // Üreticinin yazacağı sonraki indeks
+  std::atomic<uint16_t> tail;   // Tüketicinin okuyacağı sonraki indeks
+  std::atomic<uint32_t> dropped;
+};
+
+#endif // SPSC_QUEUE_H
@@ -2,37 +2,50 @@
 #define UTILS_H
 
 #include <Arduino.h>
+#include "Log.h"
 
 class Utils {
 public:
-  // Debug mesajlarını yazdırma fonksiyonu
+  // Debug mesajlarını yazdırma fonksiyonu (LOG_LEVEL_DEBUG seviyesinde)
   static void printDebug(const char* message, bool newLine = true) {
-    #if defined(DEBUG_ENABLED)
-      if (newLine) {
-        Serial.println(message);
-      } else {
-        Serial.print(message);
-      }
-    #endif
+    if (newLine) {
+      LOG_DEBUG(message);
+    } else if (Log::enabled(LOG_LEVEL_DEBUG)) {
+      Log::Sink<Log::enabled(LOG_LEVEL_DEBUG)>::write(message);
+    }
   }
   
-  // Byte dizisini hex formatında yazdırma
+  // Byte dizisini hex formatında yazdırma (LOG_LEVEL_DEBUG seviyesinde)
   static void printHex(const uint8_t* buffer, size_t size) {
-    #if defined(DEBUG_ENABLED)
-      for (size_t i = 0; i < size; i++) {
-        if (buffer[i] < 16) {
-          Serial.print('0');
-        }
-        Serial.print(buffer[i], HEX);
-      }
-      Serial.println();
-    #endif
+    LOG_HEX_AT(LOG_LEVEL_DEBUG, "", buffer, size);
   }
   
   // Mevcut zaman damgasını alma (milisaniye)
+  // Zamanlama mantığı millis() yerine bunu kullanır; böylece saat tek noktadan
+  // (ör. sanal zamanlı bir simülasyonda) değiştirilebilir
+#if defined(ESP32)
   static uint32_t getTimestamp() {
     return millis();
   }
+#else
+  typedef uint32_t (*ClockSource)();
+
+  static uint32_t getTimestamp() {
+    return clockSource()();
+  }
+
+  // Host derlemesi: saat kaynağını değiştir (ör. Utils::setClock(SimClock::nowMs));
+  // nullptr ile millis()'e dönülür. Görevler başlamadan önce çağrılmalıdır
+  static void setClock(ClockSource source) {
+    clockSource() = source ? source : millis;
+  }
+
+private:
+  static ClockSource& clockSource() {
+    static ClockSource source = millis;
+    return source;
+  }
+#endif
 };
 
 #endif // UTILS_H 
\ No newline at end of file
@@ -0,0 +1,202 @@
+#ifndef PAYLOAD_CODEC_H
+#define PAYLOAD_CODEC_H
+
+// Kompakt tipli sensör kodlayıcı/çözücü
+//
+// Yalnızca <stdint.h> ve <string.h> kullanır; aynı başlık hem ESP32 üzerinde
+// hem de sunucu/Linux tarafında çözümleme için derlenebilir.
+//
+// Çerçeve düzeni:
+//   [0]   Başlık: üst 4 bit sürüm (PAYLOAD_CODEC_VERSION), bit 0 = anahtar çerçeve
+//   [1..] Alanlar, yazıldıkları sırayla:
+//         - varint:   7 bitlik gruplar, düşük grup önce, devam biti 0x80
+//         - zigzag:   işaretli tamsayı (n << 1) ^ (n >> 31) ile işaretsize çevrilip varint
+//         - sabit nokta: round(değer * ölçek) zigzag olarak
+//         - delta:    anahtar çerçevede mutlak değer, diğerlerinde önceki
+//                     çerçevedeki aynı kanala göre fark (zigzag)
+//
+// Delta kanalları her iki uçta da aynı sırayla işlenmelidir. Bir çerçeve
+// kaybolursa bir sonraki anahtar çerçeveye kadar delta değerleri geçersizdir.
+// Taşan (hasOverflow) çerçevenin taşmadan sonraki kanalları duruma yazılmaz;
+// böyle bir çerçeve gönderilmemeli, sıradaki çerçeve anahtar çerçeve olmalıdır.
+
+#include <stdint.h>
+#include <string.h>
+
+#define PAYLOAD_CODEC_VERSION    1
+#define PAYLOAD_FLAG_KEYFRAME    0x01
+#define PAYLOAD_DELTA_CHANNELS   8
+
+namespace PayloadCodec {
+
+inline uint32_t zigzagEncode(int32_t value) {
+  return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+inline int32_t zigzagDecode(uint32_t value) {
+  return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+inline int32_t toFixed(float value, float scale) {
+  float scaled = value * scale;
+  return (int32_t)(scaled < 0 ? scaled - 0.5f : scaled + 0.5f);
+}
+
+} // namespace PayloadCodec
+
+// Delta kodlaması için çerçeveler arası durum (kodlayıcı ve çözücüde ayrı tutulur)
+struct PayloadDeltaState {
+  int32_t previous[PAYLOAD_DELTA_CHANNELS];
+  
+  PayloadDeltaState() {
+    memset(previous, 0, sizeof(previous));
+  }
+};
+
+// Sabit boyutlu tampona kompakt çerçeve yazar
+class PayloadWriter {
+public:
+  PayloadWriter(uint8_t* buffer, uint8_t capacity, PayloadDeltaState* deltaState = nullptr) :
+    buf(buffer), cap(capacity), len(0), keyFrame(true), overflow(false), delta(deltaState) {
+  }
+  
+  // Yeni çerçeve başlat; anahtar çerçevede delta kanalları mutlak değer yazar
+  void begin(bool isKeyFrame) {
+    len = 0;
+    overflow = false;
+    keyFrame = isKeyFrame || delta == nullptr;
+    writeByte((PAYLOAD_CODEC_VERSION << 4) | (keyFrame ? PAYLOAD_FLAG_KEYFRAME : 0));
+  }
+  
+  void writeByte(uint8_t value) {
+    if (len >= cap) {
+      overflow = true;
+      return;
+    }
+    buf[len++] = value;
+  }
+  
+  void writeVarUint(uint32_t value) {
+    while (value >= 0x80) {
+      writeByte((uint8_t)(value | 0x80));
+      value >>= 7;
+    }
+    writeByte((uint8_t)value);
+  }
+  
+  void writeVarInt(int32_t value) {
+    writeVarUint(PayloadCodec::zigzagEncode(value));
+  }
+  
+  // Ör. sıcaklık 23.45 °C, ölçek 100 -> 2345
+  void writeFixed(float value, float scale) {
+    writeVarInt(PayloadCodec::toFixed(value, scale));
+  }
+  
+  void writeDelta(uint8_t channel, int32_t value) {
+    if (!delta || channel >= PAYLOAD_DELTA_CHANNELS) {
+      writeVarInt(value);
+      return;
+    }
+    // Fark uint32_t'de alınır: taşma sarılır (int32_t'de tanımsız davranış),
+    // okuyucu aynı sarmayla geri çevirir
+    writeVarInt(keyFrame ? value : (int32_t)((uint32_t)value - (uint32_t)delta->previous[channel]));
+    
+    // Sığmayan çerçeve gönderilmez; durum okuyucununkinden ayrılmamalı
+    if (!overflow) {
+      delta->previous[channel] = value;
+    }
+  }
+  
+  void writeFixedDelta(uint8_t channel, float value, float scale) {
+    writeDelta(channel, PayloadCodec::toFixed(value, scale));
+  }
+  
+  uint8_t size() const { return len; }
+  bool hasOverflow() const { return overflow; }
+  
+private:
+  uint8_t* buf;
+  uint8_t cap;
+  uint8_t len;
+  bool keyFrame;
+  bool overflow;
+  PayloadDeltaState* delta;
+};
+
+// PayloadWriter ile yazılmış çerçeveyi okur
+class PayloadReader {
+public:
+  PayloadReader(const uint8_t* buffer, uint8_t length, PayloadDeltaState* deltaState = nullptr) :
+    buf(buffer), len(length), pos(0), version(0), keyFrame(true), error(false), delta(deltaState) {
+  }
+  
+  // Başlığı oku; sürüm uyuşmazsa false döner
+  bool begin() {
+    pos = 0;
+    error = false;
+    uint8_t header = readByte();
+    version = header >> 4;
+    keyFrame = (header & PAYLOAD_FLAG_KEYFRAME) != 0;
+    return !error && version == PAYLOAD_CODEC_VERSION;
+  }
+  
+  uint8_t readByte() {
+    if (pos >= len) {
+      error = true;
+      return 0;
+    }
+    return buf[pos++];
+  }
+  
+  uint32_t readVarUint() {
+    uint32_t value = 0;
+    for (uint8_t shift = 0; shift < 35; shift += 7) {
+      uint8_t b = readByte();
+      if (error) return 0;
+      value |= (uint32_t)(b & 0x7F) << shift;
+      if (!(b & 0x80)) return value;
+    }
+    error = true; // 5 byte'tan uzun varint geçersiz
+    return 0;
+  }
+  
+  int32_t readVarInt() {
+    return PayloadCodec::zigzagDecode(readVarUint());
+  }
+  
+  float readFixed(float scale) {
+    return readVarInt() / scale;
+  }
+  
+  int32_t readDelta(uint8_t channel) {
+    int32_t raw = readVarInt();
+    if (!delta || channel >= PAYLOAD_DELTA_CHANNELS) {
+      return raw;
+    }
+    int32_t value = keyFrame ? raw : (int32_t)((uint32_t)delta->previous[channel] + (uint32_t)raw);
+    if (!error) {
+      delta->previous[channel] = value;
+    }
+    return value;
+  }
+  
+  float readFixedDelta(uint8_t channel, float scale) {
+    return readDelta(channel) / scale;
+  }
+  
+  bool isKeyFrame() const { return keyFrame; }
+  bool hasError() const { return error; }
+  bool atEnd() const { return pos >= len; }
+  
+private:
+  const uint8_t* buf;
+  uint8_t len;
+  uint8_t pos;
+  uint8_t version;
+  bool keyFrame;
+  bool error;
+  PayloadDeltaState* delta;
+};
+
+#endif // PAYLOAD_CODEC_H
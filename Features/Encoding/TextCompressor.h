@@ -0,0 +1,135 @@
+#ifndef TEXT_COMPRESSOR_H
+#define TEXT_COMPRESSOR_H
+
+// Kısa metin mesajları için önceden paylaşılmış sözlük ile sıkıştırma
+//
+// Yalnızca <stdint.h> ve <string.h> kullanır; sunucu tarafı çözücü aynı
+// başlıkla derlenebilir.
+//
+// Çerçeve düzeni:
+//   Sıkıştırılmamış: ASCII/UTF-8 metin olduğu gibi (ilk byte hiçbir zaman 0x81 değildir,
+//                    geçerli UTF-8'de 0x81 yalnızca devam byte'ı olabilir)
+//   Sıkıştırılmış:   [0] = TEXT_COMPRESSED_MARKER (üst bit = sıkıştırma bayrağı,
+//                          alt 7 bit = sözlük sürümü)
+//                    [1..] 0x00-0x7F aynen ASCII karakter,
+//                          0x80-0xFF sözlük girdisi (indeks = byte - 0x80)
+//
+// Sözlük değiştirilirse TEXT_DICTIONARY_VERSION artırılmalıdır; çözücü
+// tanımadığı sürümü reddeder.
+
+#include <stdint.h>
+#include <string.h>
+
+#define TEXT_DICTIONARY_VERSION  1
+#define TEXT_COMPRESSED_MARKER   (0x80 | TEXT_DICTIONARY_VERSION)
+
+namespace TextCompressor {
+
+// Cihaz durum/alarm mesajlarında sık geçen parçalar (en fazla 128 girdi).
+// Uzun girdiler önce denenir; sıralama sıkıştırma oranını etkilemez.
+static const char* const kDictionary[] = {
+  "BASARISIZ", "BASARILI", "baglanti", "Baglanti", "gonderildi", "Gonderildi",
+  "basarisiz", "basarili", "sicaklik", "Sicaklik", "batarya", "Batarya",
+  "katildi", "katilma", "yeniden", "Yeniden", "kesildi", "alindi", "ALARM",
+  "alarm", "hatasi", "Hatasi", "durum", "Durum", "sensor", "Sensor",
+  "nem", "Nem", "basinc", "Basinc", "voltaj", "Voltaj", "dusuk", "DUSUK",
+  "yuksek", "YUKSEK", "normal", "NORMAL", "acildi", "kapandi", "kapali",
+  "acik", "ACIK", "KAPALI", "hata", "HATA", "uyari", "UYARI", "tamam",
+  "TAMAM", "status", "Status", "error", "Error", "ERROR", "warning", "OK",
+  "temp", "Temp", "battery", "low", "high", "door", "open", "closed",
+  "iletim", "Iletim", "mesaj", "Mesaj", "veri", "Veri", "Aga", "aga",
+  "cihaz", "Cihaz", "kapi", "Kapi", "seviye", "Seviye", "reset", "RESET",
+  "JOIN", "ACK", "RX", "TX", ": ", ", ", "=", " #", "%", "  ", " ",
+};
+
+static const uint8_t kDictionarySize = sizeof(kDictionary) / sizeof(kDictionary[0]);
+
+// Girdiyi sıkıştır. Sıkıştırılmış çerçeve daha kısa değilse veya metin
+// ASCII dışı karakter içeriyorsa 0 döner (çağıran metni olduğu gibi gönderir).
+inline uint8_t compress(const char* text, uint8_t length, uint8_t* out, uint8_t capacity) {
+  if (!text || length == 0 || capacity < 2) {
+    return 0;
+  }
+  
+  uint8_t outLen = 0;
+  out[outLen++] = TEXT_COMPRESSED_MARKER;
+  
+  uint8_t pos = 0;
+  while (pos < length) {
+    uint8_t c = (uint8_t)text[pos];
+    if (c & 0x80) {
+      return 0; // ASCII dışı karakterler sözlük indeksleriyle çakışır
+    }
+    
+    // En uzun sözlük eşleşmesini bul
+    int16_t best = -1;
+    uint8_t bestLen = 1;
+    for (uint8_t i = 0; i < kDictionarySize; i++) {
+      const char* entry = kDictionary[i];
+      if ((uint8_t)entry[0] != c) continue;
+      
+      uint8_t entryLen = strlen(entry);
+      if (entryLen > bestLen && entryLen <= length - pos &&
+          memcmp(entry, text + pos, entryLen) == 0) {
+        best = i;
+        bestLen = entryLen;
+      } else if (best < 0 && entryLen == 1) {
+        best = i;
+      }
+    }
+    
+    if (outLen >= capacity) {
+      return 0;
+    }
+    out[outLen++] = best >= 0 ? (uint8_t)(0x80 + best) : c;
+    pos += best >= 0 ? bestLen : 1;
+  }
+  
+  return outLen < length ? outLen : 0;
+}
+
+// Çerçevenin sıkıştırılmış olup olmadığını başlık byte'ından anla
+inline bool isCompressed(const uint8_t* frame, uint8_t length) {
+  return length > 0 && frame[0] == TEXT_COMPRESSED_MARKER;
+}
+
+// Sıkıştırılmış çerçeveyi aç; sonuç NUL ile sonlandırılır.
+// Hatalı girdi veya yetersiz kapasitede -1 döner.
+inline int16_t decompress(const uint8_t* frame, uint8_t length, char* out, uint16_t capacity) {
+  if (!isCompressed(frame, length) || capacity == 0) {
+    return -1;
+  }
+  
+  uint16_t outLen = 0;
+  for (uint8_t i = 1; i < length; i++) {
+    uint8_t b = frame[i];
+    const char* piece;
+    uint8_t pieceLen;
+    char literal = (char)b;
+    
+    if (b & 0x80) {
+      uint8_t index = b - 0x80;
+      if (index >= kDictionarySize) {
+        return -1;
+      }
+      piece = kDictionary[index];
+      pieceLen = strlen(piece);
+    } else {
+      piece = &literal;
+      pieceLen = 1;
+    }
+    
+    if (outLen + pieceLen >= capacity) {
+      return -1;
+    }
+    memcpy(out + outLen, piece, pieceLen);
+    outLen += pieceLen;
+  }
+  
+  out[outLen] = '\0';
+  return outLen;
+}
+
+} // namespace TextCompressor
+
+#endif // TEXT_COMPRESSOR_H
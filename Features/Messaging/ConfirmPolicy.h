@@ -0,0 +1,45 @@
+#ifndef CONFIRM_POLICY_H
+#define CONFIRM_POLICY_H
+
+#include <Arduino.h>
+#include "../../Core/Config/AppConfig.h"
+
+// Onaylı/onaysız uplink politikası sayaçları
+struct ConfirmPolicyStats {
+  uint32_t confirmedSent;     // ACK istenen çerçeveler
+  uint32_t unconfirmedSent;   // ACK istenmeyen çerçeveler
+  uint32_t acked;             // ACK alınan onaylı çerçeveler
+  uint32_t missed;            // ACK alınamayan onaylı çerçeveler
+  uint32_t savedAirtimeMs;    // Onaysız gönderim sayesinde kaçınılan tahmini yayın süresi
+  uint8_t ackInterval;        // Şu anki N: her N. çerçevede ACK istenir
+  uint8_t ackRatePercent;     // Gözlenen ACK başarı oranı (üstel ortalama)
+};
+
+// Varsayılan olarak onaysız gönderir; her N. çerçevede veya kritik
+// mesajlarda ACK ister. N, gözlenen ACK başarı oranına göre uyarlanır:
+// bağlantı iyiyse seyrek, ACK'lar kayboluyorsa sık kontrol edilir.
+class ConfirmPolicy {
+public:
+  ConfirmPolicy();
+  
+  // Sıradaki çerçeve onaylı mı gönderilmeli
+  bool shouldConfirm(bool critical);
+  
+  // Çerçeve LMIC'e teslim edildiğinde çağrılır
+  // airtimeMs: çerçevenin uplink yayın süresi, ackAirtimeMs: boş ACK downlink süresi
+  void onSent(bool confirmed, uint32_t airtimeMs, uint32_t ackAirtimeMs);
+  
+  // Onaylı çerçevenin sonucu (EV_TXCOMPLETE)
+  void onConfirmedResult(bool acked);
+  
+  const ConfirmPolicyStats& getStats() const;
+  
+private:
+  ConfirmPolicyStats stats;
+  uint8_t framesSinceConfirm;
+  uint16_t ackRate;   // 0..256 sabit nokta (256 = %100)
+  
+  void adapt();
+};
+
+#endif // CONFIRM_POLICY_H
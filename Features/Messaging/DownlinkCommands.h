@@ -0,0 +1,56 @@
+#ifndef DOWNLINK_COMMANDS_H
+#define DOWNLINK_COMMANDS_H
+
+#include <Arduino.h>
+#include "../../Core/Config/AppConfig.h"
+#include "DownlinkDispatcher.h"
+
+class LoraManager;
+class MessageService;
+
+// Komut çerçevesi (DOWNLINK_COMMAND_PORT): [işlem kodu][argümanlar] [işlem kodu]...
+// Çok byte'lı argümanlar big-endian'dır.
+enum DownlinkOpcode : uint8_t {
+  DOWNLINK_OP_SET_INTERVAL = 0x01,  // u16 saniye (>= DOWNLINK_MIN_INTERVAL_S)
+  DOWNLINK_OP_SET_DATARATE = 0x02,  // u8 DR (bölge planında geçerli olmalı)
+  DOWNLINK_OP_STATUS       = 0x03   // argümansız; DOWNLINK_STATUS_PORT'tan durum uplink'i
+};
+
+struct DownlinkCommandStats {
+  uint32_t executed;   // Uygulanan komut
+  uint32_t rejected;   // Argümanı eksik veya geçersiz komut
+  uint32_t unknown;    // Bilinmeyen işlem kodu (çerçevenin kalanı atlanır)
+};
+
+// Komut portunun işleyicisi
+//
+// Yük LMIC.frame içinde okunur; durum yanıtı çerçevenin tamamı ayrıştırıldıktan
+// sonra kuyruğa alınır, çünkü gönderim LMIC.frame'i hemen yeniden yazabilir.
+class DownlinkCommands {
+public:
+  DownlinkCommands();
+
+  bool begin(DownlinkDispatcher& dispatcher, LoraManager* lora, MessageService* messages);
+
+  // Uygulamanın uplink aralığı (downlink ile değiştirilebilir)
+  uint32_t getSendIntervalMs() const;
+
+  const DownlinkCommandStats& getStats() const;
+
+  // Komut çerçevesini işle (port denetimi yapılmaz)
+  void execute(PayloadView payload);
+
+private:
+  LoraManager* loraManager;
+  MessageService* messageService;
+  uint32_t sendIntervalMs;
+  DownlinkCommandStats stats;
+
+  bool setInterval(PayloadView& payload);
+  bool setDatarate(PayloadView& payload);
+  bool sendStatus();
+
+  static void onCommand(void* context, uint8_t port, PayloadView payload);
+};
+
+#endif // DOWNLINK_COMMANDS_H
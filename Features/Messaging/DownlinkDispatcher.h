@@ -0,0 +1,55 @@
+#ifndef DOWNLINK_DISPATCHER_H
+#define DOWNLINK_DISPATCHER_H
+
+#include <stdint.h>
+#include "../../Core/Utils/PayloadView.h"
+
+#define DOWNLINK_ROUTES        8     // Kayıtlı port işleyicisi yuvası
+#define DOWNLINK_PORT_MIN      1     // 0: yalnızca MAC komutları
+#define DOWNLINK_PORT_MAX      223   // 224 ve üstü LoRaWAN tarafından ayrılmış
+
+// FPort işleyicisi; yük LMIC.frame içindeki görünümdür ve yalnızca çağrı
+// süresince geçerlidir. İşleyici uplink başlatacaksa önce yükü okumayı bitirmelidir.
+typedef void (*DownlinkHandler)(void* context, uint8_t port, PayloadView payload);
+
+struct DownlinkDispatchStats {
+  uint32_t dispatched;   // İşleyicisine verilen downlink
+  uint32_t unrouted;     // İşleyicisi olmayan porttan gelen downlink
+  uint32_t bytes;        // İşleyicilere verilen toplam yük
+};
+
+// FPort'a göre downlink dağıtıcısı
+//
+// LoraManager::setDownlinkHandler(DownlinkDispatcher::onDownlink, &dispatcher)
+// ile bağlanır. Yük kopyalanmaz: işleyiciler LMIC geri çağırması döndükten
+// sonra, LoraManager::loop() içinde, EV_TXCOMPLETE abonelerinden önce çağrılır.
+class DownlinkDispatcher {
+public:
+  DownlinkDispatcher();
+
+  // Port işleyicisini kaydet (port başına bir işleyici; var olan değiştirilir)
+  bool on(uint8_t port, DownlinkHandler handler, void* context);
+  bool off(uint8_t port);
+
+  // Yükü portun işleyicisine ver; işleyici yoksa false
+  bool dispatch(uint8_t port, PayloadView payload);
+
+  const DownlinkDispatchStats& getStats() const;
+
+  // LoraDownlinkHandler imzası (context: DownlinkDispatcher*)
+  static void onDownlink(void* context, uint8_t port, PayloadView payload);
+
+private:
+  struct Route {
+    uint8_t port;          // 0: boş yuva
+    DownlinkHandler handler;
+    void* context;
+  };
+
+  Route routes[DOWNLINK_ROUTES];
+  DownlinkDispatchStats stats;
+
+  Route* find(uint8_t port);
+};
+
+#endif // DOWNLINK_DISPATCHER_H
@@ -3,6 +3,18 @@
 
 #include <Arduino.h>
 #include "../../Core/Lora/LoraManager.h"
+#include "UplinkQueue.h"
+#include "UplinkAggregator.h"
+#include "ConfirmPolicy.h"
+#include "../../Core/Utils/SpscQueue.h"
+
+// Başka bir görevden (postData) radyo görevine aktarılan uplink isteği
+struct UplinkRequest {
+  uint8_t data[UPLINK_SLOT_SIZE];
+  uint8_t size;
+  uint8_t port;
+  uint8_t priority;
+};
 
 class MessageService {
 public:
@@ -11,26 +23,89 @@ public:
   // Servis başlatma
   void setup(LoraManager* loraManager);
   
-  // Metin mesajı gönderme
-  bool sendMessage(const char* message);
+  // Kuyruğu boşaltma ve süresi geçen mesajları atma
+  void loop();
+  
+  // Metin mesajını kuyruğa alma (deadlineMs: göreli son teslim süresi, 0 = süresiz)
+  bool sendMessage(const char* message, uint8_t priority = PRIORITY_NORMAL, uint32_t deadlineMs = 0);
+  
+  // Özel veri formatını kuyruğa alma
+  bool sendData(uint8_t* data, uint8_t size, uint8_t port = 1,
+                uint8_t priority = PRIORITY_NORMAL, uint32_t deadlineMs = 0);
+  
+  // Başka bir görevden (DUAL_CORE_MODE'da UI) güvenle çağrılabilir: istek
+  // sınırlı kilitsiz kuyruğa kopyalanır ve radyo görevindeki loop() içinde
+  // sendData ile işlenir. sendMessage/sendData yalnızca radyo görevinden çağrılmalıdır.
+  bool postData(const uint8_t* data, uint8_t size, uint8_t port = 1, uint8_t priority = PRIORITY_NORMAL);
+  
+  // Bekleyen iletim ve RAM'de kuyruklanmış veri yok (derin uykuda kaybolacak bir şey yok)
+  bool isIdle() const;
+  
+  // Geçerli veri hızında gönderilebilecek azami yük (byte)
+  uint8_t getMaxPayloadSize() const;
+  
+  // Görev döngüsüne göre bir sonraki yasal gönderim zamanı (ms, mutlak)
+  uint32_t nextSendTime() const;
+  
+  // Küçük bir kaydı birleştirme aşamasına ekle (tek çerçevede toplanır)
+  bool addRecord(uint8_t type, const uint8_t* data, uint8_t length);
+  
+  // Birleştirme aşamasına doğrudan erişim (eşik ayarları, sayaçlar)
+  UplinkAggregator& getAggregator();
+  
+  // Metin mesajları için sözlük tabanlı sıkıştırma (varsayılan kapalı)
+  void setTextCompression(bool enabled);
   
-  // Özel veri formatı gönderme
-  bool sendData(uint8_t* data, uint8_t size, uint8_t port = 1);
+  // Onaylı/onaysız uplink politikası sayaçları (kaçınılan yayın süresi dahil)
+  const ConfirmPolicyStats& getConfirmStats() const;
+  
+  // Kuyruk dolduğunda uygulanacak politika
+  void setDropPolicy(DropPolicy policy);
+  
+  // Kuyruk derinliği ve atılan mesaj sayaçları
+  const UplinkQueueStats& getQueueStats() const;
   
 private:
   LoraManager* loraManager;
   
-  // Mesaj gönderim durumu
+  // Mesaj gönderim durumu (LMIC'te bekleyen bir iletim var mı)
   bool messagePending;
   
-  // TX tamamlandı geri çağırma işlevi
-  static void onTxComplete(bool success);
+  // LMIC'te bekleyen çerçeve ACK istenerek mi gönderildi
+  bool pendingConfirmed;
+  
+  // LMIC'te bekleyen mesajın kopyası; sonucu gelmezse kuyruğa geri konur
+  UplinkMessage inFlight;
+  
+  // Metin sıkıştırma etkin mi
+  bool textCompression;
+  
+  // Her çerçevede ACK isteyip istemeyeceğine karar veren politika
+  ConfirmPolicy confirmPolicy;
+  
+  // Gönderilmeyi bekleyen mesajlar
+  UplinkQueue queue;
+  
+  // Küçük kayıtları tek çerçevede toplayan aşama
+  UplinkAggregator aggregator;
+  
+  // postData ile gelen, henüz kuyruğa alınmamış istekler (UI -> radyo)
+  SpscQueue<UplinkRequest, UPLINK_INBOX_CAPACITY> inbox;
+  
+  // Kuyruktaki sıradaki mesajı LMIC'e teslim etmeyi dene
+  bool trySendNext();
+  
+  // Birleştirilmiş çerçeveyi uplink kuyruğuna aktar
+  static bool onAggregateFlush(void* context, uint8_t* frame, uint8_t size);
+  
+  // TX sonucu (TXCOMPLETE / TXCANCELED) işlendiğinde sıradaki mesaja geç
+  void onTxComplete(const LoraEvent& event);
   
-  // LoRa olayları geri çağırma işlevi
-  static void onLoraEvent(ev_t event);
+  // Sıfırlama, bağlantı kaybı veya yeniden join: bekleyen iletimin sonucu gelmez
+  void onLinkLost(const LoraEvent& event);
   
-  // Static pointer to MessageService instance for callbacks
-  static MessageService* messageServiceInstance;
+  // LoraManager olay veriyolu işleyicisi; context = MessageService*
+  static void onLoraEvent(void* context, const LoraEvent& event);
 };
 
 #endif // MESSAGE_SERVICE_H 
\ No newline at end of file
@@ -0,0 +1,85 @@
+#ifndef UPLINK_AGGREGATOR_H
+#define UPLINK_AGGREGATOR_H
+
+#include <Arduino.h>
+#include "../../Core/Config/AppConfig.h"
+#include "../../Core/Utils/Utils.h"
+#include "../../Core/Lora/RegionPlan.h"
+
+// Birleştirilmiş uplink çerçeve düzeni (tüm alanlar byte):
+//
+//   [0]      Başlık: üst 4 bit sürüm (AGGREGATE_FRAME_VERSION), alt 4 bit ayrılmış (0)
+//   [1]      Kayıt sayısı (N)
+//   Ardından N kayıt:
+//     [+0]   Kayıt tipi (uygulama tanımlı, 0-255)
+//     [+1]   Kayıt veri uzunluğu (L)
+//     [+2..] L byte kayıt verisi
+//
+// Sunucu tarafında çözümleme: ilk iki byte okunur, ardından N kez
+// {tip, uzunluk, veri} okunur. Çerçeve AGGREGATE_PORT portundan gönderilir.
+#define AGGREGATE_FRAME_VERSION  1
+#define AGGREGATE_HEADER_SIZE    2
+#define AGGREGATE_RECORD_HEADER  2
+
+// Çerçeve hazır olduğunda çağrılan gönderim işlevi
+typedef bool (*AggregateFlushCallback)(void* context, uint8_t* frame, uint8_t size);
+
+// Küçük uygulama kayıtlarını tek bir LoRaWAN çerçevesinde toplayan aşama
+class UplinkAggregator {
+public:
+  UplinkAggregator();
+  
+  // Çerçeve gönderim hedefini ayarla
+  void setFlushCallback(AggregateFlushCallback callback, void* context);
+  
+  // Çerçevenin azami boyutu (geçerli veri hızına göre güncellenir)
+  void setMaxFrameSize(uint8_t size);
+  
+  // Boyut eşiği (byte) ve gecikme eşiği (ms) - biri aşılınca çerçeve gönderilir
+  // Varsayılan boyut eşiği çerçevenin tamamen dolmasıdır
+  void setThresholds(uint8_t sizeThreshold, uint32_t latencyMs);
+  
+  // Kayıt ekle; sığmazsa mevcut çerçeve önce gönderilir
+  bool addRecord(uint8_t type, const uint8_t* data, uint8_t length);
+  
+  // Gecikme eşiğini kontrol et (ana döngüden çağrılır)
+  void loop();
+  
+  // Bekleyen kayıtları hemen gönder. Sınır kayıtlar eklendikten sonra
+  // küçüldüyse kayıtlar sığan çerçevelere bölünür; tek başına sığmayan kayıt
+  // atılır. Gönderilemeyen kayıtlar korunur ve false döner
+  bool flush();
+  
+  uint8_t pendingRecords() const;
+  uint8_t pendingBytes() const;
+  
+  // Toplama etkinliğini ölçmek için sayaçlar
+  uint32_t getRecordCount() const;
+  uint32_t getFrameCount() const;
+  
+  // Veri hızı düştükten sonra tek başına çerçeveye sığmadığı için atılan kayıt
+  uint32_t getDroppedCount() const;
+  
+private:
+  uint8_t frame[UPLINK_SLOT_SIZE];
+  uint8_t frameSize;
+  uint8_t recordCount;
+  uint8_t maxFrameSize;
+  uint8_t sizeThreshold;
+  uint32_t latencyMs;
+  uint32_t firstRecordTime;
+  
+  AggregateFlushCallback flushCallback;
+  void* flushContext;
+  
+  uint32_t totalRecords;
+  uint32_t totalFrames;
+  uint32_t droppedRecords;
+  
+  void reset();
+  
+  // Geçerli sınıra tek başına sığmayan kayıtları çerçeveden çıkar
+  void dropOversizeRecords();
+};
+
+#endif // UPLINK_AGGREGATOR_H
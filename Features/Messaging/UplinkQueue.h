@@ -0,0 +1,93 @@
+#ifndef UPLINK_QUEUE_H
+#define UPLINK_QUEUE_H
+
+#include <Arduino.h>
+#include "../../Core/Config/AppConfig.h"
+#include "../../Core/Utils/Utils.h"
+
+// Uplink öncelik seviyeleri (büyük değer = yüksek öncelik)
+enum UplinkPriority : uint8_t {
+  PRIORITY_LOW = 0,
+  PRIORITY_NORMAL = 1,
+  PRIORITY_HIGH = 2,
+  PRIORITY_CRITICAL = 3    // Her zaman onaylı (ACK istenerek) gönderilir
+};
+
+// Kuyruk dolduğunda uygulanacak politika
+enum DropPolicy : uint8_t {
+  DROP_OLDEST,            // En eski mesajı at, yenisini kabul et
+  DROP_LOWEST_PRIORITY,   // En düşük öncelikli (eşitse en eski) mesajı at
+  DROP_REJECT             // Yeni mesajı reddet
+};
+
+// Kuyruktaki tek bir uplink mesajı
+struct UplinkMessage {
+  uint8_t data[UPLINK_SLOT_SIZE];
+  uint8_t size;
+  uint8_t port;
+  uint8_t priority;
+  bool critical;       // Onay politikasından bağımsız olarak ACK iste
+  uint32_t sequence;   // Eşit öncelikte FIFO sırası için
+  uint32_t deadline;   // Mutlak zaman damgası (ms), 0 = süresiz
+};
+
+// Kuyruk boyutlandırması için sayaçlar
+struct UplinkQueueStats {
+  uint8_t depth;             // Anlık doluluk
+  uint8_t maxDepth;          // Görülen en yüksek doluluk
+  uint32_t enqueued;         // Kabul edilen mesaj sayısı
+  uint32_t sent;             // LMIC'e teslim edilen mesaj sayısı (yeniden teslimler dahil)
+  uint32_t droppedOverflow;  // Kuyruk dolu olduğu için atılan eski mesajlar
+  uint32_t droppedExpired;   // Son teslim zamanı geçtiği için atılan mesajlar
+  uint32_t rejected;         // Kabul edilmeyen yeni mesajlar
+  uint32_t droppedOversize;  // Veri hızı düştüğü için artık sığmayan mesajlar
+  uint32_t requeued;         // Sonucu gelmeden LMIC sıfırlandığı için geri konan mesajlar
+  uint32_t droppedInFlight;  // Sonucu gelmeyen ve geri konamayan (kuyruk dolu/süresi geçmiş) mesajlar
+};
+
+// Sabit kapasiteli, dinamik bellek kullanmayan öncelikli uplink kuyruğu
+class UplinkQueue {
+public:
+  UplinkQueue();
+  
+  void setDropPolicy(DropPolicy policy);
+  DropPolicy getDropPolicy() const;
+  
+  // Mesajı kopyalayarak kuyruğa ekle; deadlineMs göreli süredir (0 = süresiz)
+  bool push(const uint8_t* data, uint8_t size, uint8_t port, uint8_t priority,
+            uint32_t deadlineMs, bool critical);
+  
+  // Gönderilecek sıradaki mesaj (en yüksek öncelik, eşitse en eski)
+  // Süresi geçmiş mesajlar bu sırada kuyruktan atılır
+  const UplinkMessage* peek();
+  
+  // peek() ile dönen mesajı kuyruktan çıkar (gönderildi olarak say)
+  void pop();
+  
+  // peek() ile dönen mesajı gönderilemez olarak at
+  void discard();
+  
+  // LMIC'e teslim edilmiş ama sonucu gelmeyecek mesajı geri koy; sıra
+  // numarası korunduğundan eşit öncelikte yine başa geçer
+  bool requeue(const UplinkMessage& message);
+  
+  uint8_t depth() const;
+  bool isEmpty() const;
+  const UplinkQueueStats& getStats() const;
+  
+private:
+  UplinkMessage slots[UPLINK_QUEUE_CAPACITY];
+  bool used[UPLINK_QUEUE_CAPACITY];
+  uint8_t count;
+  uint32_t nextSequence;
+  int8_t headIndex;
+  DropPolicy dropPolicy;
+  UplinkQueueStats stats;
+  
+  void expire(uint32_t now);
+  int8_t findFree() const;
+  int8_t findVictim() const;
+  void release(uint8_t index);
+};
+
+#endif // UPLINK_QUEUE_H
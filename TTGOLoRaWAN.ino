@@ -2,6 +2,12 @@
 #include "Core/Lora/LoraManager.h"
 #include "Features/Messaging/MessageService.h"
 #include "Core/Display/DisplayManager.h"
+#include "Features/Encoding/PayloadCodec.h"
+#include "Core/Utils/Profiler.h"
+#include "Core/Lora/LowPower.h"
+#include "Core/Lora/RadioTask.h"
+#include "Features/Messaging/DownlinkDispatcher.h"
+#include "Features/Messaging/DownlinkCommands.h"
 
 // Libraries for LoRa
 #include <SPI.h>
@@ -16,10 +22,12 @@
 LoraManager loraManager;
 MessageService messageService;
 DisplayManager displayManager;
+DownlinkDispatcher downlinkDispatcher;
+DownlinkCommands downlinkCommands;
 
-// Zaman yönetimi
-unsigned long lastSendTime = 0;
-const unsigned long sendInterval = 60000; // 60 saniyede bir veri gönder
+// Zaman yönetimi (gönderim aralığı: downlinkCommands.getSendIntervalMs());
+// Utils::getTimestamp() cinsinden, LowPower uyanma zamanıyla aynı saat
+uint32_t lastSendTime = 0;
 
 // define the pins used by the LoRa transceiver module
 #define SCK 5
@@ -36,6 +44,14 @@ const unsigned long sendInterval = 60000; // 60 saniyede bir veri gönder
 //915E6 for North America
 #define BAND 868E6
 
+// Radyo LMIC'e (LoraManager) ait: ham LoRa kütüphanesi başlatılmaz, paketler
+// MessageService üzerinden LoRaWAN uplink'i olarak gider
+#define LMIC_OWNS_RADIO (DUAL_CORE_MODE || LOW_POWER_MODE)
+
+#if DUAL_CORE_MODE && LOW_POWER_MODE
+#error "LOW_POWER_MODE tek çekirdekli loop() ile çalışır; DUAL_CORE_MODE'u kapatın"
+#endif
+
 // OLED pins
 #define OLED_SDA 4
 #define OLED_SCL 15
@@ -43,27 +59,30 @@ const unsigned long sendInterval = 60000; // 60 saniyede bir veri gönder
 #define SCREEN_WIDTH 128 // OLED display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
 
-String inputString = "";        // Serial'dan gelen komutları tutmak için
-bool stringComplete = false;    // Serial komutun tamamlandığını belirtmek için
+// Seri komut satırı ve LoRa paketi için sabit tamponlar (String ile yığın
+// parçalanmasını ve byte başına yeniden ayırmayı önler)
+#define SERIAL_LINE_CAPACITY 64    // Sonlandırıcı dahil en uzun komut satırı
+#define LORA_PACKET_CAPACITY 255   // SX1276 azami paket boyutu
+
+char serialLine[SERIAL_LINE_CAPACITY];   // Serial'dan gelen komut satırı
+uint8_t serialLineLength = 0;
+bool serialLineComplete = false;         // Satır sonu alındı, işlenmeyi bekliyor
+bool serialLineOverflow = false;         // Satır sığmadı; satır sonuna kadar atılır
+uint8_t packetBuffer[LORA_PACKET_CAPACITY + 1];  // Gelen LoRa paketi (+ metin sonlandırıcı)
+
 bool displayOn = true;          // Ekranın açık olup olmadığını takip etmek için
 int transmitCounter = 0;        // Gönderilen paket sayacı
+int txPower = 14;               // TX gücü (dBm); LoRa kütüphanesi geri okumaz
 
 Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RST);
 
 void setup() {
   // initialize Serial Monitor
   Serial.begin(115200);
-  inputString.reserve(200);
   
   Serial.println("TTGO LoRaWAN Test");
   Serial.println("Komutlar:");
-  Serial.println("DISPLAY_ON - Ekranı açar");
-  Serial.println("DISPLAY_OFF - Ekranı kapatır");
-  Serial.println("STATUS - Cihaz durumunu gösterir");
-  Serial.println("TRANSMIT - Bir LoRa paketi gönderir");
-  Serial.println("SF9 - Spreading Factor'ü 9 yapar");
-  Serial.println("SF10 - Spreading Factor'ü 10 yapar");
-  Serial.println("SF11 - Spreading Factor'ü 11 yapar");
+  printCommandHelp();
 
   // reset OLED display via software
   pinMode(OLED_RST, OUTPUT);
@@ -85,6 +104,7 @@ void setup() {
   display.print("TTGO LoRaWAN Test");
   display.display();
   
+#if !LMIC_OWNS_RADIO
   // SPI LoRa pins
   SPI.begin(SCK, MISO, MOSI, SS);
   // setup LoRa transceiver module
@@ -107,8 +127,39 @@ void setup() {
   LoRa.setSpreadingFactor(9);      // SF9
   LoRa.setSignalBandwidth(125E3);  // 125 kHz
   LoRa.setCodingRate4(5);          // 4/5 coding rate
-  LoRa.setTxPower(14);             // 14 dBm
+  LoRa.setTxPower(txPower);        // 14 dBm
   LoRa.enableCrc();                // CRC etkinleştir
+#endif
+  
+  // FPort'lu downlink'ler kopyalanmadan porta göre dağıtılır
+  loraManager.setDownlinkHandler(DownlinkDispatcher::onDownlink, &downlinkDispatcher);
+  downlinkCommands.begin(downlinkDispatcher, &loraManager, &messageService);
+  
+#if LMIC_OWNS_RADIO
+  // Derin uykudan uyanışta oturum RTC'den gelir, join yapılmaz
+  loraManager.setup();
+  messageService.setup(&loraManager);
+#endif
+  
+#if LOW_POWER_MODE
+  // Derin uyku gönderim zamanına kadar sürer ve saat sıfırdan başlar;
+  // zamanlayıcıyla uyanışta ilk loop() turu hemen gönderir
+  if (LowPower::wokeFromDeepSleep()) {
+    lastSendTime = Utils::getTimestamp() - downlinkCommands.getSendIntervalMs();
+  }
+#endif
+  
+#if DUAL_CORE_MODE
+  // LMIC ve MessageService RADIO_TASK_CORE'daki görevde döner; bu loop()
+  // yalnızca Serial'a ve ekrana bakar
+  if (!RadioTask::start(&loraManager, serviceMessages, &messageService)) {
+    Serial.println("Radyo görevi başlatılamadı!");
+    display.setCursor(0,10);
+    display.print("Radyo görevi yok!");
+    display.display();
+    while (1);
+  }
+#endif
   
   delay(2000);
   updateDisplay();
@@ -116,89 +167,304 @@ void setup() {
 
 void loop() {
   // Seri porttan gelen komutları işle
-  if (stringComplete) {
-    processCommand();
-    inputString = "";
-    stringComplete = false;
+  if (serialLineComplete) {
+    processCommand(serialLine);
+    serialLineLength = 0;
+    serialLineComplete = false;
   }
   
+#if LMIC_OWNS_RADIO
+  // Periyodik uplink; aralık sunucudan downlink ile değiştirilebilir
+  uint32_t now = Utils::getTimestamp();
+  if (now - lastSendTime >= downlinkCommands.getSendIntervalMs()) {
+    lastSendTime = now;
+    sendPacket();
+  }
+#endif
+  
+#if DUAL_CORE_MODE
+  // Radyo görevinin kuyruğa eklediği ekran komutları ve log kayıtları
+  loraManager.serviceUi();
+#elif LOW_POWER_MODE
+  loraManager.loop();
+  messageService.loop();
+  
+  // Boştayken bir sonraki periyodik gönderime, kuyrukta veri varken görev
+  // döngüsünün izin verdiği ana kadar uyu; bekleyen seri komut varsa uyunmaz
+  bool idle = messageService.isIdle() && !serialLineComplete;
+  uint32_t wakeAt = idle ? lastSendTime + downlinkCommands.getSendIntervalMs()
+                         : messageService.nextSendTime();
+  SleepPlan plan = LowPower::plan(loraManager, wakeAt, idle);
+  if (plan.durationMs) {
+    // Ekran DisplayManager değil sketch'in SSD1306 nesnesi; uykuda kapatılır
+    if (displayOn) {
+      display.ssd1306_command(SSD1306_DISPLAYOFF);
+    }
+    LowPower::sleep(loraManager, nullptr, plan);   // Derin uykuda dönmez
+    if (displayOn) {
+      display.ssd1306_command(SSD1306_DISPLAYON);
+    }
+  }
+#else
   // LoRa paketlerini dinle
   int packetSize = LoRa.parsePacket();
   if (packetSize) {
     receiveMessage(packetSize);
   }
+#endif
+}
+
+// Radyo görevinde her turda LoraManager::loop()'tan sonra çağrılır
+void serviceMessages(void* context) {
+  static_cast<MessageService*>(context)->loop();
 }
 
 void serialEvent() {
-  while (Serial.available()) {
+  // Önceki satır işlenene kadar yeni byte'lar UART tamponunda bekler
+  while (!serialLineComplete && Serial.available()) {
     char inChar = (char)Serial.read();
-    inputString += inChar;
+    
     if (inChar == '\n') {
-      stringComplete = true;
+      if (serialLineOverflow) {
+        Serial.println("Komut satırı çok uzun, yok sayıldı");
+        serialLineOverflow = false;
+        serialLineLength = 0;
+        continue;
+      }
+      serialLine[serialLineLength] = '\0';
+      serialLineComplete = true;
+    }
+    else if (inChar == '\r') {
+      continue;
+    }
+    else if (serialLineLength < SERIAL_LINE_CAPACITY - 1) {
+      serialLine[serialLineLength++] = inChar;
+    }
+    else {
+      serialLineOverflow = true;
     }
   }
 }
 
-void processCommand() {
-  inputString.trim();
-  
-  if (inputString.equals("DISPLAY_ON")) {
-    displayOn = true;
-    display.ssd1306_command(SSD1306_DISPLAYON);
-    Serial.println("Ekran açıldı");
-    updateDisplay();
-  } 
-  else if (inputString.equals("DISPLAY_OFF")) {
-    displayOn = false;
-    display.ssd1306_command(SSD1306_DISPLAYOFF);
-    Serial.println("Ekran kapatıldı");
+// Seri komut işleyicileri; argümansız komutlarda parametre adsız bırakılır
+void cmdDisplayOn(long /*value*/) {
+  displayOn = true;
+  display.ssd1306_command(SSD1306_DISPLAYON);
+  Serial.println("Ekran açıldı");
+  updateDisplay();
+}
+
+void cmdDisplayOff(long /*value*/) {
+  displayOn = false;
+  display.ssd1306_command(SSD1306_DISPLAYOFF);
+  Serial.println("Ekran kapatıldı");
+}
+
+void cmdStatus(long /*value*/) {
+  Serial.println("Cihaz Durumu:");
+  Serial.print("Ekran: ");
+  Serial.println(displayOn ? "AÇIK" : "KAPALI");
+  Serial.print("LoRa Frekansı: ");
+  Serial.print(BAND / 1E6);
+  Serial.println(" MHz");
+#if !LMIC_OWNS_RADIO
+  Serial.print("Spreading Factor: ");
+  Serial.println(LoRa.getSpreadingFactor());
+  Serial.print("TX Gücü: ");
+  Serial.print(txPower);
+  Serial.println(" dBm");
+#endif
+  printHeapReport();
+  Profiler::printReport(Serial);
+  LowPower::printReport(Serial);
+  loraManager.getRxCalibration().printReport(Serial);
+  loraManager.getRadioProfile().printReport(Serial);
+}
+
+void cmdProfileDump(long /*value*/) {
+  // Derlemeler arası karşılaştırma için: tools/profile_compare
+  Profiler::dump(Serial);
+}
+
+void cmdProfileReset(long /*value*/) {
+  Profiler::reset();
+  Serial.println("Süre histogramları sıfırlandı");
+}
+
+void cmdTraceDump(long /*value*/) {
+  // Zaman çizelgesi için: tools/trace_view
+  loraManager.getEventTrace().dump(Serial);
+}
+
+void cmdRejoin(long /*value*/) {
+  loraManager.forgetSession();
+  Serial.println("Kayıtlı oturum silindi, yeniden ağa katılınıyor");
+}
+
+void cmdTransmit(long /*value*/) {
+  sendPacket();
+}
+
+void cmdSpreadingFactor(long value) {
+#if LMIC_OWNS_RADIO
+  Serial.println("Veri hızı RadioProfile ve ADR ile belirlenir");
+#else
+  LoRa.setSpreadingFactor(value);
+  Serial.print("Spreading Factor ");
+  Serial.print(value);
+  Serial.println(" olarak ayarlandı");
+  updateDisplay();
+#endif
+}
+
+void cmdTxPower(long value) {
+#if LMIC_OWNS_RADIO
+  Serial.println("TX gücü RadioProfile ve ADR ile belirlenir");
+#else
+  txPower = value;
+  LoRa.setTxPower(txPower);
+  Serial.print("TX gücü ");
+  Serial.print(txPower);
+  Serial.println(" dBm olarak ayarlandı");
+#endif
+}
+
+// Komut tablosu: ad, argüman sayısı (0/1), argüman aralığı, işleyici, açıklama
+struct SerialCommand {
+  const char* name;
+  uint8_t argCount;
+  long minValue;
+  long maxValue;
+  void (*handler)(long value);
+  const char* help;
+};
+
+static const SerialCommand kSerialCommands[] = {
+  { "DISPLAY_ON",    0, 0, 0,  cmdDisplayOn,       "Ekranı açar" },
+  { "DISPLAY_OFF",   0, 0, 0,  cmdDisplayOff,      "Ekranı kapatır" },
+  { "STATUS",        0, 0, 0,  cmdStatus,          "Cihaz durumunu gösterir" },
+  { "TRANSMIT",      0, 0, 0,  cmdTransmit,        "Bir LoRa paketi gönderir" },
+  { "SF",            1, 7, 12, cmdSpreadingFactor, "Spreading Factor'ü ayarlar" },
+  { "TXPOWER",       1, 2, 20, cmdTxPower,         "TX gücünü dBm olarak ayarlar" },
+  { "PROFILE_DUMP",  0, 0, 0,  cmdProfileDump,     "Süre histogramlarını ikili olarak gönderir" },
+  { "PROFILE_RESET", 0, 0, 0,  cmdProfileReset,    "Süre histogramlarını sıfırlar" },
+  { "TRACE_DUMP",    0, 0, 0,  cmdTraceDump,       "LMIC olay izini ikili olarak gönderir" },
+  { "REJOIN",        0, 0, 0,  cmdRejoin,          "Kayıtlı oturumu siler ve yeniden ağa katılır" },
+};
+
+static const uint8_t kSerialCommandCount = sizeof(kSerialCommands) / sizeof(kSerialCommands[0]);
+
+void printCommandHelp() {
+  for (uint8_t i = 0; i < kSerialCommandCount; i++) {
+    const SerialCommand& cmd = kSerialCommands[i];
+    Serial.print(cmd.name);
+    if (cmd.argCount) {
+      Serial.print(" <");
+      Serial.print(cmd.minValue);
+      Serial.print("-");
+      Serial.print(cmd.maxValue);
+      Serial.print(">");
+    }
+    Serial.print(" - ");
+    Serial.println(cmd.help);
   }
-  else if (inputString.equals("STATUS")) {
-    Serial.println("Cihaz Durumu:");
-    Serial.print("Ekran: ");
-    Serial.println(displayOn ? "AÇIK" : "KAPALI");
-    Serial.print("LoRa Frekansı: ");
-    Serial.print(BAND / 1E6);
-    Serial.println(" MHz");
-    Serial.print("Spreading Factor: ");
-    Serial.println(LoRa.getSpreadingFactor());
+}
+
+// Yığın durumu: boş, en düşük boş (kullanımın tepe noktası) ve en büyük ayrılabilir blok
+void printHeapReport() {
+#if defined(ESP32)
+  char line[72];
+  snprintf(line, sizeof(line), "Heap: boş %lu, en düşük %lu, en büyük blok %lu byte",
+           (unsigned long)ESP.getFreeHeap(),
+           (unsigned long)ESP.getMinFreeHeap(),
+           (unsigned long)ESP.getMaxAllocHeap());
+  Serial.println(line);
+#endif
+}
+
+// Satırı yerinde ayrıştır: "<AD> [<tamsayı>]"
+void processCommand(char* line) {
+  PROFILE_SCOPE(PROF_SERIAL_COMMAND);
+  
+  char* name = line;
+  while (*name == ' ' || *name == '\t') {
+    name++;
   }
-  else if (inputString.equals("TRANSMIT")) {
-    sendPacket();
+  char* args = name;
+  while (*args && *args != ' ' && *args != '\t') {
+    args++;
   }
-  else if (inputString.equals("SF9")) {
-    LoRa.setSpreadingFactor(9);
-    Serial.println("Spreading Factor 9 olarak ayarlandı");
-    updateDisplay();
+  if (*args) {
+    *args++ = '\0';
   }
-  else if (inputString.equals("SF10")) {
-    LoRa.setSpreadingFactor(10);
-    Serial.println("Spreading Factor 10 olarak ayarlandı");
-    updateDisplay();
+  while (*args == ' ' || *args == '\t') {
+    args++;
   }
-  else if (inputString.equals("SF11")) {
-    LoRa.setSpreadingFactor(11);
-    Serial.println("Spreading Factor 11 olarak ayarlandı");
-    updateDisplay();
+  
+  if (*name == '\0') {
+    return;
   }
-  else {
-    Serial.println("Tanınmayan komut. Kullanılabilir komutlar:");
-    Serial.println("DISPLAY_ON - Ekranı açar");
-    Serial.println("DISPLAY_OFF - Ekranı kapatır");
-    Serial.println("STATUS - Cihaz durumunu gösterir");
-    Serial.println("TRANSMIT - Bir LoRa paketi gönderir");
-    Serial.println("SF9/SF10/SF11 - Spreading Factor'ü değiştirir");
+  
+  for (uint8_t i = 0; i < kSerialCommandCount; i++) {
+    const SerialCommand& cmd = kSerialCommands[i];
+    if (strcmp(name, cmd.name) != 0) {
+      continue;
+    }
+    
+    long value = 0;
+    if (cmd.argCount) {
+      char* end;
+      value = strtol(args, &end, 10);
+      while (*end == ' ' || *end == '\t') {
+        end++;
+      }
+      if (end == args || *end != '\0' || value < cmd.minValue || value > cmd.maxValue) {
+        Serial.print("Geçersiz argüman: ");
+        Serial.print(cmd.name);
+        Serial.print(" <");
+        Serial.print(cmd.minValue);
+        Serial.print("-");
+        Serial.print(cmd.maxValue);
+        Serial.println(">");
+        return;
+      }
+    }
+    else if (*args) {
+      Serial.print(cmd.name);
+      Serial.println(" argüman almaz");
+      return;
+    }
+    
+    cmd.handler(value);
+    return;
   }
+  
+  Serial.println("Tanınmayan komut. Kullanılabilir komutlar:");
+  printCommandHelp();
 }
 
 void sendPacket() {
   transmitCounter++;
   
+  // Paket sayacını kompakt ikili formatta kodla (metin yerine 2-6 byte)
+  uint8_t payload[8];
+  PayloadWriter writer(payload, sizeof(payload));
+  writer.begin(true);
+  writer.writeVarUint(transmitCounter);
+  
   // Paket gönder
+#if LMIC_OWNS_RADIO
+  // Radyo görevine kilitsiz gelen kutusu üzerinden (bkz. MessageService::postData)
+  if (!messageService.postData(payload, writer.size())) {
+    Serial.println("Gönderim kuyruğu dolu, paket atlandı");
+    transmitCounter--;
+    return;
+  }
+#else
   LoRa.beginPacket();
-  LoRa.print("TTGO LoRa Test Paket #");
-  LoRa.print(transmitCounter);
+  LoRa.write(payload, writer.size());
   LoRa.endPacket();
+#endif
   
   Serial.print("Paket gönderildi: #");
   Serial.println(transmitCounter);
@@ -229,8 +495,12 @@ void updateDisplay() {
   display.print(BAND / 1E6);
   display.println(" MHz");
   display.setCursor(0,30);
+#if LMIC_OWNS_RADIO
+  display.println("Mod: LoRaWAN");
+#else
   display.print("SF: ");
   display.println(LoRa.getSpreadingFactor());
+#endif
   display.setCursor(0,40);
   display.print("Son Paket: #");
   display.println(transmitCounter);
@@ -238,12 +508,12 @@ void updateDisplay() {
 }
 
 void receiveMessage(int packetSize) {
-  String message = "";
+  PROFILE_SCOPE(PROF_LORA_RECEIVE);
   
-  // Mesajı oku
-  while (LoRa.available()) {
-    message += (char)LoRa.read();
-  }
+  // Mesajı tek seferde önceden ayrılmış tampona oku
+  int length = packetSize < LORA_PACKET_CAPACITY ? packetSize : LORA_PACKET_CAPACITY;
+  length = LoRa.readBytes(packetBuffer, length);
+  packetBuffer[length] = '\0';
   
   // RSSI (Sinyal gücü) ve SNR (Sinyal-gürültü oranı) değerlerini al
   int rssi = LoRa.packetRssi();
@@ -251,7 +521,8 @@ void receiveMessage(int packetSize) {
   
   Serial.println("Gelen LoRa paketi:");
   Serial.print("Mesaj: ");
-  Serial.println(message);
+  Serial.write(packetBuffer, length);
+  Serial.println();
   Serial.print("RSSI: ");
   Serial.println(rssi);
   Serial.print("SNR: ");
@@ -263,7 +534,7 @@ void receiveMessage(int packetSize) {
     display.println("GELEN PAKET");
     display.setCursor(0,10);
     display.print("Mesaj: ");
-    display.println(message);
+    display.println((const char*)packetBuffer);
     display.setCursor(0,30);
     display.print("RSSI: ");
     display.println(rssi);
@@ -0,0 +1,46 @@
+#include "SimClock.h"
+#include <atomic>
+#include <chrono>
+
+static std::atomic<bool> virtualMode(false);
+static std::atomic<uint64_t> virtualUs(0);
+static const std::chrono::steady_clock::time_point realStart = std::chrono::steady_clock::now();
+
+void SimClock::setVirtual(bool enabled) {
+  if (enabled && !virtualMode) {
+    virtualUs = nowUs();
+  }
+  virtualMode = enabled;
+}
+
+bool SimClock::isVirtual() {
+  return virtualMode;
+}
+
+uint64_t SimClock::nowUs() {
+  if (virtualMode) {
+    return virtualUs;
+  }
+  return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - realStart).count();
+}
+
+uint32_t SimClock::nowMs() {
+  return (uint32_t)(nowUs() / 1000);
+}
+
+void SimClock::advanceUs(uint64_t us) {
+  if (virtualMode) {
+    virtualUs += us;
+  }
+}
+
+void SimClock::advanceMs(uint32_t ms) {
+  advanceUs((uint64_t)ms * 1000);
+}
+
+void SimClock::setUs(uint64_t us) {
+  if (virtualMode) {
+    virtualUs = us;
+  }
+}
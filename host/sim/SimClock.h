@@ -0,0 +1,27 @@
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+#include <stdint.h>
+
+// Simülasyon saati
+//
+// Varsayılan olarak gerçek (monoton) zamanı izler. setVirtual(true) ile
+// sanal zamana geçilir; zaman yalnızca advanceUs() ile ilerler, böylece
+// dakikalar süren join ve RX pencereleri milisaniyeler içinde ve her
+// çalıştırmada aynı sırayla simüle edilir. LMIC modelinin os_getTime()'ı bu
+// saati okur; uygulama tarafı Utils::setClock(SimClock::nowMs) ile bağlanır.
+class SimClock {
+public:
+  static void setVirtual(bool enabled);
+  static bool isVirtual();
+
+  static uint64_t nowUs();
+  static uint32_t nowMs();
+
+  // Yalnızca sanal modda etkilidir
+  static void advanceUs(uint64_t us);
+  static void advanceMs(uint32_t ms);
+  static void setUs(uint64_t us);
+};
+
+#endif // SIM_CLOCK_H
@@ -0,0 +1,788 @@
+#include "SimLmic.h"
+#include "SimClock.h"
+#include "SimRadio.h"
+#include <Arduino.h>
+#include "../../Core/Lora/Airtime.h"
+
+// LMIC MAC katmanının host modeli (bkz. lmic.h)
+//
+// Tek iş (LMIC.osjob) uplink'i şu adımlarla yürütür:
+//   startTx   -> kanal ve bant seçimi, çerçeve, EV_TXSTART
+//   txDone    -> LMIC.txend, RX1 penceresinin zamanlanması
+//   rxOpen    -> EV_RXSTART; önsöz pencereye denk gelirse rxDone, gelmezse rxTimeout
+//   rxTimeout -> RX1 ise RX2'yi zamanla, RX2 ise downlink'siz bitir
+//   rxDone    -> join-accept veya veri çerçevesini işle (EV_JOINED / EV_TXCOMPLETE)
+// Pencere açılışı ve rxsyms MCCI LMIC'teki gibi saat hatasından hesaplanır;
+// downlink'in yakalanması SimRadio'nun verdiği önsöz kaymasına bağlıdır.
+
+lmic_t LMIC;
+
+#define MINRX_SYMS      6   // Sınıf A penceresinde en az dinlenen sembol
+#define MAX_RXSYMS      255 // LMIC.rxsyms (u1_t) sınırı
+#define DETECT_SYMS     4   // Önsözün yakalanması için pencerede kalması gereken sembol
+#define PREAMBLE_SYMS   8
+#define ILLEGAL_RPS     ((rps_t)0xFF)
+
+// ---- Bölge varsayılanları (LMIC_reset) ----
+
+#if CFG_LMIC_EU_like
+#if defined(CFG_as923)
+static const u4_t kDefaultFreqs[] = { 923200000, 923400000 };
+static const u4_t kRx2Freq = 923200000;
+static const dr_t kRx2Dr = DR_SF10;
+static const u2_t kBandTxcap = 100;
+#elif defined(CFG_kr920)
+static const u4_t kDefaultFreqs[] = { 922100000, 922300000, 922500000 };
+static const u4_t kRx2Freq = 921900000;
+static const dr_t kRx2Dr = DR_SF12;
+static const u2_t kBandTxcap = 1;
+#elif defined(CFG_in866)
+static const u4_t kDefaultFreqs[] = { 865062500, 865402500, 865985000 };
+static const u4_t kRx2Freq = 866550000;
+static const dr_t kRx2Dr = DR_SF10;
+static const u2_t kBandTxcap = 1;
+#else
+static const u4_t kDefaultFreqs[] = { 868100000, 868300000, 868500000 };
+static const u4_t kRx2Freq = 869525000;
+static const dr_t kRx2Dr = DR_SF12;
+#endif
+static const u1_t kDefaultChannels = sizeof(kDefaultFreqs) / sizeof(kDefaultFreqs[0]);
+#else
+static const u4_t kRx2Freq = 923300000;
+static const dr_t kRx2Dr = DR_SF12CR;
+#endif
+
+// ---- Zamanlayıcı ----
+
+static osjob_t* scheduledJobs = nullptr;
+static uint32_t jobCount = 0;
+
+static void unlinkJob(osjob_t* job) {
+  for (osjob_t** p = &scheduledJobs; *p; p = &(*p)->next) {
+    if (*p == job) {
+      *p = job->next;
+      job->next = nullptr;
+      return;
+    }
+  }
+}
+
+int os_init_ex(const void* pintab) {
+  (void)pintab;
+  scheduledJobs = nullptr;
+  memset(&LMIC, 0, sizeof(LMIC));
+  LMIC.opmode = OP_SHUTDOWN;
+  return 1;
+}
+
+ostime_t os_getTime() {
+  return (ostime_t)(u4_t)(SimClock::nowUs() >> US_PER_OSTICK_EXPONENT);
+}
+
+void os_setTimedCallback(osjob_t* job, ostime_t time, osjobcb_t* cb) {
+  unlinkJob(job);
+  job->deadline = time;
+  job->func = cb;
+
+  // Aynı zamanlı işler eklenme sırasıyla çalışır
+  osjob_t** p = &scheduledJobs;
+  while (*p && (*p)->deadline - time <= 0) {
+    p = &(*p)->next;
+  }
+  job->next = *p;
+  *p = job;
+}
+
+void os_setCallback(osjob_t* job, osjobcb_t* cb) {
+  os_setTimedCallback(job, os_getTime(), cb);
+}
+
+void os_clearCallback(osjob_t* job) {
+  unlinkJob(job);
+}
+
+void os_runloop_once() {
+  osjob_t* job = scheduledJobs;
+  if (!job || job->deadline - os_getTime() > 0) {
+    return;
+  }
+  scheduledJobs = job->next;
+  job->next = nullptr;
+  jobCount++;
+  job->func(job);
+}
+
+bit_t os_queryTimeCriticalJobs(ostime_t time) {
+  return scheduledJobs && scheduledJobs->deadline - os_getTime() < time;
+}
+
+bool SimLmic::nextJobTime(ostime_t& time) {
+  if (!scheduledJobs) {
+    return false;
+  }
+  time = scheduledJobs->deadline;
+  return true;
+}
+
+uint32_t SimLmic::jobsRun() {
+  return jobCount;
+}
+
+// ---- Radyo parametreleri ----
+
+rps_t updr2rps(dr_t datarate) {
+#if CFG_LMIC_US_like
+  switch (datarate) {
+    case DR_SF10:   return makeRps(SF10, BW125, CR_4_5, 0, 0);
+    case DR_SF9:    return makeRps(SF9, BW125, CR_4_5, 0, 0);
+    case DR_SF8:    return makeRps(SF8, BW125, CR_4_5, 0, 0);
+    case DR_SF7:    return makeRps(SF7, BW125, CR_4_5, 0, 0);
+    case DR_SF8C:   return makeRps(SF8, BW500, CR_4_5, 0, 0);
+    case DR_SF12CR: return makeRps(SF12, BW500, CR_4_5, 0, 0);
+    case DR_SF11CR: return makeRps(SF11, BW500, CR_4_5, 0, 0);
+    case DR_SF10CR: return makeRps(SF10, BW500, CR_4_5, 0, 0);
+    case DR_SF9CR:  return makeRps(SF9, BW500, CR_4_5, 0, 0);
+    case DR_SF8CR:  return makeRps(SF8, BW500, CR_4_5, 0, 0);
+    case DR_SF7CR:  return makeRps(SF7, BW500, CR_4_5, 0, 0);
+    default:        return ILLEGAL_RPS;
+  }
+#else
+  switch (datarate) {
+    case DR_SF12: return makeRps(SF12, BW125, CR_4_5, 0, 0);
+    case DR_SF11: return makeRps(SF11, BW125, CR_4_5, 0, 0);
+    case DR_SF10: return makeRps(SF10, BW125, CR_4_5, 0, 0);
+    case DR_SF9:  return makeRps(SF9, BW125, CR_4_5, 0, 0);
+    case DR_SF8:  return makeRps(SF8, BW125, CR_4_5, 0, 0);
+    case DR_SF7:  return makeRps(SF7, BW125, CR_4_5, 0, 0);
+    case DR_SF7B: return makeRps(SF7, BW250, CR_4_5, 0, 0);
+    case DR_FSK:  return makeRps(FSK, BW125, CR_4_5, 0, 0);
+    default:      return ILLEGAL_RPS;
+  }
+#endif
+}
+
+// Downlink'lerde PHY CRC yoktur
+static rps_t dndr2rps(dr_t datarate) {
+  rps_t rps = updr2rps(datarate);
+  return makeRps(getSf(rps), getBw(rps), getCr(rps), 0, 1);
+}
+
+static uint32_t symbolUs(rps_t rps) {
+  if (getSf(rps) == FSK) {
+    return 160;
+  }
+  return (uint32_t)(((uint64_t)1 << (getSf(rps) - SF7 + 7)) * 1000000ULL / (125000UL << getBw(rps)));
+}
+
+static uint32_t airtimeUs(rps_t rps, u1_t length) {
+  if (getSf(rps) == FSK) {
+    // 50 kbps: önsöz(5) + senkron(3) + uzunluk(1) + yük + CRC(2) byte
+    return ((uint32_t)length + 11) * 160;
+  }
+  LoraTxParams p;
+  p.spreadingFactor = getSf(rps) - SF7 + 7;
+  p.bandwidthHz = 125000UL << getBw(rps);
+  p.codingRate = getCr(rps) - CR_4_5 + 1;
+  p.preambleSymbols = PREAMBLE_SYMS;
+  p.explicitHeader = getIh(rps) == 0;
+  p.crc = getNocrc(rps) == 0;
+  return Airtime::timeOnAirUs(p, length);
+}
+
+// ---- Kanallar ----
+
+static void initDefaultChannels() {
+#if CFG_LMIC_EU_like
+  memset(LMIC.channelFreq, 0, sizeof(LMIC.channelFreq));
+  memset(LMIC.channelDrMap, 0, sizeof(LMIC.channelDrMap));
+  LMIC.channelMap = 0;
+  for (u1_t ch = 0; ch < kDefaultChannels; ch++) {
+#if defined(CFG_eu868)
+    LMIC.channelFreq[ch] = kDefaultFreqs[ch] | BAND_CENTI;
+#else
+    LMIC.channelFreq[ch] = kDefaultFreqs[ch];
+#endif
+    LMIC.channelDrMap[ch] = DR_RANGE_MAP(DR_SF12, DR_SF7);
+    LMIC.channelMap |= 1 << ch;
+  }
+
+  ostime_t now = os_getTime();
+  for (u1_t band = 0; band < MAX_BANDS; band++) {
+    LMIC.bands[band].txcap = 1;
+    LMIC.bands[band].txpow = 14;
+    LMIC.bands[band].lastchnl = 0;
+    LMIC.bands[band].avail = now;
+  }
+#if defined(CFG_eu868)
+  LMIC.bands[BAND_MILLI].txcap = 1000;
+  LMIC.bands[BAND_CENTI].txcap = 100;
+  LMIC.bands[BAND_DECI].txcap = 10;
+  LMIC.bands[BAND_AUX].txcap = 100;
+#else
+  LMIC.bands[0].txcap = kBandTxcap;
+#endif
+#else
+  // 0-63: 125 kHz, 64-71: 500 kHz; hepsi açık
+  for (u1_t i = 0; i < (MAX_CHANNELS + 15) / 16; i++) {
+    LMIC.channelMap[i] = 0xFFFF;
+  }
+  LMIC.channelMap[MAX_CHANNELS / 16] = 0x00FF;
+#endif
+}
+
+static u4_t channelFrequency(u1_t ch) {
+#if CFG_LMIC_EU_like
+  return LMIC.channelFreq[ch] & ~(u4_t)3;
+#else
+  return ch < 64 ? 902300000 + 200000 * (u4_t)ch : 903000000 + 1600000 * (u4_t)(ch - 64);
+#endif
+}
+
+static bool channelUsable(u1_t ch) {
+#if CFG_LMIC_EU_like
+  return LMIC.channelFreq[ch] != 0 && (LMIC.channelMap & (1 << ch)) &&
+         (LMIC.channelDrMap[ch] & (1 << LMIC.datarate));
+#else
+  if (!(LMIC.channelMap[ch >> 4] & (1 << (ch & 15)))) {
+    return false;
+  }
+  return LMIC.datarate == DR_SF8C ? ch >= 64 : ch < 64;
+#endif
+}
+
+// Kanalın bandının tekrar kullanılabileceği zaman
+static ostime_t channelAvail(u1_t ch, ostime_t now) {
+#if CFG_LMIC_EU_like
+  (void)now;
+  return LMIC.bands[LMIC.channelFreq[ch] & 0x3].avail;
+#else
+  (void)ch;
+  return now;
+#endif
+}
+
+// ---- Olaylar ----
+
+static void reportEvent(ev_t ev) {
+  if (LMIC.eventCb) {
+    LMIC.eventCb(LMIC.eventUserData, ev);
+  }
+}
+
+void SimLmic::injectEvent(ev_t ev) {
+  if (ev == EV_LINK_DEAD) {
+    LMIC.opmode |= OP_LINKDEAD;
+  } else if (ev == EV_RESET) {
+    os_clearCallback(&LMIC.osjob);
+    LMIC.opmode &= ~(OP_TXDATA | OP_TXRXPEND | OP_POLL);
+  }
+  reportEvent(ev);
+}
+
+// ---- Uplink ve RX pencereleri ----
+
+// Süren uplink'in pencere durumu
+struct SimUplink {
+  bool join;
+  bool confirmed;
+  u1_t delaySec;        // RX1 gecikmesi
+  u4_t rx1Freq;
+  dr_t rx1Dr;
+  u1_t window;          // Açılan/açılacak pencere
+  dr_t dr;
+  ostime_t expected;    // Önsözün saat hatası olmadan beklenen başlangıcı
+  ostime_t open;        // Alıcının açıldığı an
+  uint32_t timeoutUs;   // Çerçeve yoksa pencerenin açık kalma süresi
+  uint32_t onUs;        // Çerçeve alınırsa alıcının açık kaldığı süre
+  bool missed;
+  SimDownlink frame;
+};
+
+static SimUplink uplink;
+
+static void startTx(osjob_t* job);
+static void rxOpen(osjob_t* job);
+
+static void buildJoinRequest() {
+  LMIC.frame[0] = 0x00;                 // MHDR: Join-request
+  os_getArtEui(LMIC.frame + 1);
+  os_getDevEui(LMIC.frame + 9);
+  LMIC.frame[17] = (u1_t)LMIC.devNonce;
+  LMIC.frame[18] = (u1_t)(LMIC.devNonce >> 8);
+  memset(LMIC.frame + 19, 0, 4);        // MIC modellenmez
+  LMIC.dataBeg = 0;
+  LMIC.dataLen = 23;
+}
+
+static void buildDataFrame() {
+  u1_t* f = LMIC.frame;
+  f[0] = LMIC.pendTxConf ? 0x80 : 0x40; // MHDR: (un)confirmed data up
+  f[1] = (u1_t)LMIC.devaddr;
+  f[2] = (u1_t)(LMIC.devaddr >> 8);
+  f[3] = (u1_t)(LMIC.devaddr >> 16);
+  f[4] = (u1_t)(LMIC.devaddr >> 24);
+  f[5] = LMIC.adrEnabled ? 0x80 : 0x00; // FCtrl, FOpts yok
+  f[6] = (u1_t)LMIC.seqnoUp;
+  f[7] = (u1_t)(LMIC.seqnoUp >> 8);
+  f[8] = LMIC.pendTxPort;
+  memcpy(f + 9, LMIC.pendTxData, LMIC.pendTxLen);
+  memset(f + 9 + LMIC.pendTxLen, 0, 4);
+  LMIC.dataBeg = 9;
+  LMIC.dataLen = LORAWAN_FRAME_OVERHEAD + LMIC.pendTxLen;
+  LMIC.seqnoUp++;
+}
+
+// RX penceresini saat hatasına göre erken aç ve sembol zaman aşımını iki yönlü
+// hatayı kapsayacak kadar genişlet. rxsyms sınıra dayanırsa pencere beklenen
+// anın etrafında ortalanır
+static void scheduleWindow(u1_t window) {
+  uplink.window = window;
+  uplink.dr = window == 1 ? uplink.rx1Dr : LMIC.dn2Dr;
+  rps_t rps = dndr2rps(uplink.dr);
+
+  ostime_t delay = sec2osticks(uplink.delaySec + window - 1);
+  uint32_t driftUs = osticks2us((int64_t)delay * LMIC.clockError / MAX_CLOCK_ERROR);
+  uint32_t symUs = symbolUs(rps);
+  uint32_t rxsyms = MINRX_SYMS + (2 * driftUs + symUs - 1) / symUs;
+  if (rxsyms > MAX_RXSYMS) {
+    rxsyms = MAX_RXSYMS;
+  }
+
+  uplink.timeoutUs = rxsyms * symUs;
+  uplink.expected = LMIC.txend + delay;
+  uplink.open = uplink.expected - us2osticks((uplink.timeoutUs - MINRX_SYMS * symUs) / 2);
+  LMIC.rxtime = uplink.open;
+  LMIC.rxsyms = (u1_t)rxsyms;
+  os_setTimedCallback(&LMIC.osjob, uplink.open, rxOpen);
+}
+
+static void txDone(osjob_t* job) {
+  LMIC.txend = job->deadline;
+  if (uplink.join) {
+    LMIC.devNonce++;
+  }
+
+  // RxDelay 0, LoRaWAN'da 1 saniye demektir; join-accept 5 saniye sonra
+  uplink.delaySec = uplink.join ? 5 : (LMIC.rxDelay ? LMIC.rxDelay : 1);
+#if CFG_LMIC_EU_like
+  uplink.rx1Freq = LMIC.freq;
+  uplink.rx1Dr = LMIC.datarate > LMIC.rx1DrOffset ? LMIC.datarate - LMIC.rx1DrOffset : 0;
+#else
+  int dr = (LMIC.datarate >= DR_SF8C ? DR_SF7CR : DR_SF10CR + LMIC.datarate) - LMIC.rx1DrOffset;
+  uplink.rx1Freq = 923300000 + (LMIC.txChnl % 8) * 600000;
+  uplink.rx1Dr = dr < DR_SF12CR ? DR_SF12CR : dr;
+#endif
+  scheduleWindow(1);
+}
+
+static void startTx(osjob_t* job) {
+  (void)job;
+  bool join = (LMIC.opmode & OP_JOINING) != 0;
+  if ((LMIC.opmode & OP_SHUTDOWN) || (!join && !(LMIC.opmode & OP_TXDATA))) {
+    return;
+  }
+
+  // Bandı açık ilk kanal (sıradaki kanaldan başlayarak); yoksa en erken açılanı bekle
+  ostime_t now = os_getTime();
+  int channel = -1;
+  bool waiting = false;
+  ostime_t earliest = 0;
+  for (u1_t i = 1; i <= MAX_CHANNELS; i++) {
+    u1_t ch = (LMIC.txChnl + i) % MAX_CHANNELS;
+    if (!channelUsable(ch)) {
+      continue;
+    }
+    ostime_t avail = channelAvail(ch, now);
+    if (avail - now <= 0) {
+      channel = ch;
+      break;
+    }
+    if (!waiting || avail - earliest < 0) {
+      earliest = avail;
+      waiting = true;
+    }
+  }
+
+  if (channel < 0) {
+    if (waiting) {
+      os_setTimedCallback(&LMIC.osjob, earliest, startTx);
+    } else if (!join) {
+      // Veri hızına uygun açık kanal yok
+      LMIC.opmode &= ~OP_TXDATA;
+      reportEvent(EV_TXCANCELED);
+    }
+    return;
+  }
+
+  LMIC.txChnl = (u1_t)channel;
+  LMIC.freq = channelFrequency(LMIC.txChnl);
+  LMIC.rps = updr2rps(LMIC.datarate);
+  LMIC.txpow = LMIC.adrTxPow;
+  LMIC.txrxFlags = 0;
+  if (join) {
+    buildJoinRequest();
+  } else {
+    buildDataFrame();
+  }
+  LMIC.opmode |= OP_TXRXPEND;
+
+  uint32_t airUs = airtimeUs(LMIC.rps, LMIC.dataLen);
+  ostime_t airTicks = us2osticks(airUs);
+#if CFG_LMIC_EU_like
+  band_t& band = LMIC.bands[LMIC.channelFreq[LMIC.txChnl] & 0x3];
+  band.avail = now + airTicks * band.txcap;
+  band.lastchnl = LMIC.txChnl;
+#endif
+
+  uplink.join = join;
+  uplink.confirmed = !join && LMIC.pendTxConf;
+
+  SimTransmission tx;
+  tx.startUs = SimClock::nowUs();
+  tx.airtimeUs = airUs;
+  tx.freq = LMIC.freq;
+  tx.rps = LMIC.rps;
+  tx.datarate = LMIC.datarate;
+  tx.length = LMIC.dataLen;
+  tx.port = join ? 0 : LMIC.pendTxPort;
+  tx.join = join;
+  tx.confirmed = uplink.confirmed;
+  SimRadio::onTransmit(tx);
+
+  os_setTimedCallback(&LMIC.osjob, now + airTicks, txDone);
+  reportEvent(EV_TXSTART);
+}
+
+// Downlink bitmeden (veya pencere kapanmadan) sonraki uplink başlamaz
+static void finishUplink(ostime_t now) {
+  LMIC.opmode &= ~OP_TXRXPEND;
+  if (uplink.join) {
+    if (LMIC.opmode & OP_JOINING) {
+      // Yeni join denemesi kısa rastgele bekleme ve bant izniyle
+      os_setTimedCallback(&LMIC.osjob, now + ms2osticks(random(1000, 3000)), startTx);
+    }
+    reportEvent(EV_JOIN_TXCOMPLETE);
+    return;
+  }
+
+  LMIC.opmode &= ~(OP_TXDATA | OP_POLL);
+  reportEvent(EV_TXCOMPLETE);
+}
+
+static void rxTimeout(osjob_t* job) {
+  SimRadio::onRxWindow(uplink.timeoutUs, false, uplink.missed);
+  if (uplink.window == 1) {
+    scheduleWindow(2);
+    return;
+  }
+
+  LMIC.dataBeg = 0;
+  LMIC.dataLen = 0;
+  LMIC.txrxFlags = uplink.join ? 0 : (TXRX_NOPORT | (uplink.confirmed ? TXRX_NACK : 0));
+  finishUplink(job->deadline);
+}
+
+static void processJoinAccept(u1_t window) {
+  const SimJoinAccept& accept = SimRadio::getJoinAccept();
+  LMIC.netid = accept.netId;
+  LMIC.devaddr = accept.devAddr;
+  for (u1_t i = 0; i < 16; i++) {
+    LMIC.nwkKey[i] = (u1_t)(accept.devAddr >> (8 * (i & 3))) ^ i;
+    LMIC.artKey[i] = (u1_t)(accept.devAddr >> (8 * (i & 3))) ^ (0xA0 + i);
+  }
+  LMIC.rxDelay = accept.rxDelay;
+  LMIC.rx1DrOffset = accept.rx1DrOffset;
+  LMIC.dn2Dr = accept.rx2Dr;
+
+#if defined(CFG_eu868)
+  // CFList: 3-7 kanalları
+  if (accept.cfList) {
+    for (u1_t i = 0; i < 5; i++) {
+      if (accept.cfListFreq[i] == 0) {
+        continue;
+      }
+      u1_t ch = 3 + i;
+      LMIC.channelFreq[ch] = accept.cfListFreq[i] | BAND_CENTI;
+      LMIC.channelDrMap[ch] = DR_RANGE_MAP(DR_SF12, DR_SF7);
+      LMIC.channelMap |= 1 << ch;
+    }
+  }
+#endif
+
+  LMIC.dataBeg = 0;
+  LMIC.dataLen = 0;
+  LMIC.seqnoUp = 0;
+  LMIC.seqnoDn = 0;
+  LMIC.txrxFlags = window == 1 ? TXRX_DNW1 : TXRX_DNW2;
+  LMIC.opmode &= ~(OP_JOINING | OP_REJOIN | OP_TXRXPEND | OP_LINKDEAD);
+
+  // Join sırasında kuyruğa alınmış veri hemen gönderilir
+  if (LMIC.opmode & OP_TXDATA) {
+    os_setCallback(&LMIC.osjob, startTx);
+  }
+  reportEvent(EV_JOINED);
+}
+
+static void processDataFrame(u1_t window, ostime_t now) {
+  const SimDownlink& d = uplink.frame;
+  u1_t* f = LMIC.frame;
+  f[0] = 0x60;                          // MHDR: unconfirmed data down
+  f[1] = (u1_t)LMIC.devaddr;
+  f[2] = (u1_t)(LMIC.devaddr >> 8);
+  f[3] = (u1_t)(LMIC.devaddr >> 16);
+  f[4] = (u1_t)(LMIC.devaddr >> 24);
+  f[5] = d.ack ? 0x20 : 0x00;
+  f[6] = (u1_t)LMIC.seqnoDn;
+  f[7] = (u1_t)(LMIC.seqnoDn >> 8);
+
+  u1_t flags = window == 1 ? TXRX_DNW1 : TXRX_DNW2;
+  if (d.port) {
+    f[8] = d.port;
+    memcpy(f + 9, d.data, d.length);
+    LMIC.dataBeg = 9;
+    LMIC.dataLen = d.length;
+    flags |= TXRX_PORT;
+  } else {
+    LMIC.dataBeg = 8;
+    LMIC.dataLen = 0;
+    flags |= TXRX_NOPORT;
+  }
+  memset(f + LMIC.dataBeg + LMIC.dataLen, 0, 4);
+
+  if (d.ack) {
+    flags |= TXRX_ACK;
+  } else if (uplink.confirmed) {
+    flags |= TXRX_NACK;
+  }
+  LMIC.txrxFlags = flags;
+  LMIC.seqnoDn++;
+  finishUplink(now);
+}
+
+static void rxDone(osjob_t* job) {
+  LMIC.rxtime = job->deadline;
+  SimRadio::onRxWindow(uplink.onUs, true, false);
+  if (uplink.frame.joinAccept) {
+    processJoinAccept(uplink.window);
+  } else {
+    processDataFrame(uplink.window, job->deadline);
+  }
+}
+
+static u1_t downlinkLength(const SimDownlink& d) {
+  if (d.joinAccept) {
+    return SimRadio::getJoinAccept().cfList ? 33 : 17;
+  }
+  // MHDR + FHDR (+ FPort + yük) + MIC
+  return 8 + (d.port ? 1 + d.length : 0) + 4;
+}
+
+static void rxOpen(osjob_t* job) {
+  (void)job;
+  rps_t rps = dndr2rps(uplink.dr);
+  LMIC.freq = uplink.window == 1 ? uplink.rx1Freq : LMIC.dn2Freq;
+  LMIC.rps = rps;
+  LMIC.dndr = uplink.dr;
+  reportEvent(EV_RXSTART);
+
+  // Önsözün en az DETECT_SYMS sembolü alıcı açıkken gelmelidir
+  SimDownlink frame;
+  bool sent = SimRadio::receive(uplink.window, frame);
+  int64_t symUs = symbolUs(rps);
+  int64_t preambleUs = osticks2us(uplink.expected - uplink.open) + SimRadio::getTimingOffsetUs();
+  int64_t from = preambleUs > 0 ? preambleUs : 0;
+  int64_t to = preambleUs + PREAMBLE_SYMS * symUs;
+  if (to > (int64_t)uplink.timeoutUs) {
+    to = uplink.timeoutUs;
+  }
+  bool detected = sent && to - from >= DETECT_SYMS * symUs;
+
+  if (detected) {
+    uplink.frame = frame;
+    uplink.missed = false;
+    int64_t doneUs = preambleUs + airtimeUs(rps, downlinkLength(frame));
+    uplink.onUs = doneUs > 0 ? (uint32_t)doneUs : 0;
+    os_setTimedCallback(&LMIC.osjob, uplink.open + us2osticks(doneUs), rxDone);
+  } else {
+    uplink.missed = sent;
+    os_setTimedCallback(&LMIC.osjob, uplink.open + us2osticks(uplink.timeoutUs), rxTimeout);
+  }
+}
+
+// ---- API ----
+
+void LMIC_reset() {
+  os_clearCallback(&LMIC.osjob);
+
+  // Kayıtlı olay geri çağırması sıfırlamadan sonra da geçerlidir
+  lmic_event_cb_t* eventCb = LMIC.eventCb;
+  void* eventUserData = LMIC.eventUserData;
+  memset(&LMIC, 0, sizeof(LMIC));
+  LMIC.eventCb = eventCb;
+  LMIC.eventUserData = eventUserData;
+
+  initDefaultChannels();
+  LMIC.opmode = OP_NONE;
+  LMIC.adrEnabled = 1;
+  LMIC.rxDelay = 1;
+  LMIC.dn2Dr = kRx2Dr;
+  LMIC.dn2Freq = kRx2Freq;
+#if CFG_LMIC_US_like
+  LMIC.datarate = DR_SF7;
+  LMIC.adrTxPow = 30;
+#else
+  LMIC.datarate = DR_SF7;
+  LMIC.adrTxPow = 14;
+#endif
+}
+
+void LMIC_shutdown() {
+  os_clearCallback(&LMIC.osjob);
+  LMIC.opmode &= ~OP_TXRXPEND;
+  LMIC.opmode |= OP_SHUTDOWN;
+}
+
+int LMIC_registerEventCb(lmic_event_cb_t* pEventCb, void* pUserData) {
+  LMIC.eventCb = pEventCb;
+  LMIC.eventUserData = pUserData;
+  return 1;
+}
+
+bit_t LMIC_startJoining() {
+  if (LMIC.devaddr != 0 || (LMIC.opmode & OP_JOINING)) {
+    return 0;
+  }
+  LMIC.opmode &= ~(OP_SHUTDOWN | OP_LINKDEAD | OP_REJOIN | OP_UNJOIN);
+  LMIC.opmode |= OP_JOINING;
+  os_setCallback(&LMIC.osjob, startTx);
+  reportEvent(EV_JOINING);
+  return 1;
+}
+
+int LMIC_setTxData2(u1_t port, xref2u1_t data, u1_t dlen, u1_t confirmed) {
+  if (LMIC.opmode & OP_TXDATA) {
+    return -1;   // LMIC_ERROR_TX_BUSY
+  }
+  if (dlen) {
+    memcpy(LMIC.pendTxData, data, dlen);
+  }
+  LMIC.pendTxPort = port;
+  LMIC.pendTxConf = confirmed;
+  LMIC.pendTxLen = dlen;
+  LMIC.opmode |= OP_TXDATA;
+
+  // Ağa katılmamışsa veri join'den sonra gönderilir
+  if (LMIC.devaddr == 0) {
+    LMIC_startJoining();
+  } else if (!(LMIC.opmode & (OP_JOINING | OP_TXRXPEND))) {
+    os_setCallback(&LMIC.osjob, startTx);
+  }
+  return 0;
+}
+
+void LMIC_setDrTxpow(dr_t dr, s1_t txpow) {
+  LMIC.datarate = dr;
+  LMIC.adrTxPow = txpow;
+}
+
+void LMIC_setAdrMode(bit_t enabled) {
+  LMIC.adrEnabled = enabled ? 1 : 0;
+}
+
+void LMIC_setLinkCheckMode(bit_t enabled) {
+  (void)enabled;
+}
+
+void LMIC_setClockError(u2_t error) {
+  LMIC.clockError = error;
+}
+
+bit_t LMIC_setupChannel(u1_t channel, u4_t freq, u2_t drmap, s1_t band) {
+#if CFG_LMIC_EU_like
+  // Varsayılan kanallar değiştirilemez
+  if (channel < kDefaultChannels || channel >= MAX_CHANNELS) {
+    return 0;
+  }
+#if defined(CFG_eu868)
+  if (band < 0) {
+    if (freq >= 869400000 && freq <= 869650000) {
+      band = BAND_DECI;
+    } else if ((freq >= 868000000 && freq <= 868600000) || (freq >= 869700000 && freq <= 870000000)) {
+      band = BAND_CENTI;
+    } else {
+      band = BAND_MILLI;
+    }
+  }
+  LMIC.channelFreq[channel] = (freq & ~(u4_t)3) | (u4_t)(band & 3);
+#else
+  (void)band;
+  LMIC.channelFreq[channel] = freq & ~(u4_t)3;
+#endif
+  LMIC.channelDrMap[channel] = drmap ? drmap : DR_RANGE_MAP(DR_SF12, DR_SF7);
+  LMIC.channelMap |= 1 << channel;
+  return 1;
+#else
+  // Sabit kanal tablosu
+  (void)channel;
+  (void)freq;
+  (void)drmap;
+  (void)band;
+  return 0;
+#endif
+}
+
+bit_t LMIC_enableChannel(u1_t channel) {
+  if (channel >= MAX_CHANNELS) {
+    return 0;
+  }
+#if CFG_LMIC_EU_like
+  if (LMIC.channelFreq[channel] == 0) {
+    return 0;
+  }
+  LMIC.channelMap |= 1 << channel;
+#else
+  LMIC.channelMap[channel >> 4] |= 1 << (channel & 15);
+#endif
+  return 1;
+}
+
+bit_t LMIC_disableChannel(u1_t channel) {
+  if (channel >= MAX_CHANNELS) {
+    return 0;
+  }
+#if CFG_LMIC_EU_like
+  LMIC.channelMap &= ~(1 << channel);
+#else
+  LMIC.channelMap[channel >> 4] &= ~(1 << (channel & 15));
+#endif
+  return 1;
+}
+
+void LMIC_setSession(u4_t netid, devaddr_t devaddr, xref2u1_t nwkKey, xref2u1_t artKey) {
+  LMIC.netid = netid;
+  LMIC.devaddr = devaddr;
+  if (nwkKey) {
+    memcpy(LMIC.nwkKey, nwkKey, sizeof(LMIC.nwkKey));
+  }
+  if (artKey) {
+    memcpy(LMIC.artKey, artKey, sizeof(LMIC.artKey));
+  }
+
+  // Join sonrası durum: varsayılan kanallar, sıfır sayaçlar, varsayılan RX parametreleri
+  initDefaultChannels();
+  LMIC.opmode &= ~(OP_JOINING | OP_REJOIN | OP_UNJOIN | OP_TXRXPEND | OP_SHUTDOWN);
+  LMIC.opmode |= OP_NEXTCHNL;
+  LMIC.seqnoUp = 0;
+  LMIC.seqnoDn = 0;
+  LMIC.rxDelay = 1;
+  LMIC.rx1DrOffset = 0;
+  LMIC.dn2Dr = kRx2Dr;
+  LMIC.dn2Freq = kRx2Freq;
+}
+
+void LMIC_getSessionKeys(u4_t* netid, devaddr_t* devaddr, xref2u1_t nwkKey, xref2u1_t artKey) {
+  *netid = LMIC.netid;
+  *devaddr = LMIC.devaddr;
+  memcpy(artKey, LMIC.artKey, sizeof(LMIC.artKey));
+  memcpy(nwkKey, LMIC.nwkKey, sizeof(LMIC.nwkKey));
+}
@@ -0,0 +1,25 @@
+#ifndef SIM_LMIC_H
+#define SIM_LMIC_H
+
+#include <lmic.h>
+
+// Host LMIC modelinin test kancaları
+//
+// LMIC API'si lmic.h'de, uygulaması SimLmic.cpp'dedir. Testler sanal saati
+// bir sonraki işe atlatmak, çalışan iş sayısını görmek ve ağ tarafında
+// oluşan olayları (EV_LINK_DEAD, EV_RESET) LMIC'in bildirdiği gibi
+// üretmek için bu sınıfı kullanır.
+class SimLmic {
+public:
+  // En erken zamanlanmış işin zamanı; iş yoksa false
+  static bool nextJobTime(ostime_t& time);
+
+  // os_runloop_once() ile çalıştırılan iş sayısı
+  static uint32_t jobsRun();
+
+  // Olayı LMIC bağlamından bildir. EV_LINK_DEAD OP_LINKDEAD bayrağını
+  // kurar; EV_RESET süren TX/RX'i ve bekleyen veriyi iptal eder
+  static void injectEvent(ev_t ev);
+};
+
+#endif // SIM_LMIC_H
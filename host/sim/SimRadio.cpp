@@ -0,0 +1,168 @@
+#include "SimRadio.h"
+
+SimJoinAccept SimRadio::joinAccept = SimRadio::defaultJoinAccept();
+SimDownlink SimRadio::downlinks[SIM_MAX_DOWNLINKS];
+uint8_t SimRadio::downlinkCount = 0;
+bool SimRadio::ackConfirmed = true;
+int32_t SimRadio::timingOffsetUs = 0;
+SimTransmission SimRadio::history[SIM_MAX_TRANSMISSIONS];
+SimTransmission SimRadio::lastTx;
+SimRadioStats SimRadio::stats;
+
+void SimRadio::reset() {
+  joinAccept = defaultJoinAccept();
+  downlinkCount = 0;
+  ackConfirmed = true;
+  timingOffsetUs = 0;
+  memset(&lastTx, 0, sizeof(lastTx));
+  memset(&stats, 0, sizeof(stats));
+}
+
+SimJoinAccept SimRadio::defaultJoinAccept() {
+  SimJoinAccept accept;
+  accept.attempt = 1;
+  accept.window = 1;
+  accept.devAddr = 0x260B1234;
+  accept.netId = 0x000013;
+  accept.rxDelay = 5;
+  accept.rx1DrOffset = 0;
+#if CFG_LMIC_US_like
+  accept.rx2Dr = DR_SF12CR;
+#else
+  accept.rx2Dr = DR_SF9;
+#endif
+  accept.cfList = true;
+  for (uint8_t i = 0; i < 5; i++) {
+    accept.cfListFreq[i] = 867100000 + 200000 * (uint32_t)i;
+  }
+  return accept;
+}
+
+void SimRadio::scriptJoinAccept(const SimJoinAccept& accept) {
+  joinAccept = accept;
+}
+
+const SimJoinAccept& SimRadio::getJoinAccept() {
+  return joinAccept;
+}
+
+bool SimRadio::queueDownlink(uint8_t port, const uint8_t* data, uint8_t length, uint8_t window) {
+  if (downlinkCount >= SIM_MAX_DOWNLINKS || length > SIM_DOWNLINK_MAX || (window != 1 && window != 2)) {
+    return false;
+  }
+  SimDownlink& d = downlinks[downlinkCount++];
+  memset(&d, 0, sizeof(d));
+  d.window = window;
+  d.port = port;
+  d.length = length;
+  if (length) {
+    memcpy(d.data, data, length);
+  }
+  return true;
+}
+
+bool SimRadio::queueResponse(uint8_t window, bool ack, uint8_t port, const uint8_t* data, uint8_t length) {
+  if (window > 2 || (window == 0 && (ack || length))) {
+    return false;
+  }
+  if (!queueDownlink(port, data, length, window ? window : 1)) {
+    return false;
+  }
+  SimDownlink& d = downlinks[downlinkCount - 1];
+  d.window = window;
+  d.ack = ack;
+  d.scripted = true;
+  return true;
+}
+
+void SimRadio::setAckConfirmed(bool enabled) {
+  ackConfirmed = enabled;
+}
+
+void SimRadio::setTimingOffsetUs(int32_t offsetUs) {
+  timingOffsetUs = offsetUs;
+}
+
+int32_t SimRadio::getTimingOffsetUs() {
+  return timingOffsetUs;
+}
+
+void SimRadio::onTransmit(const SimTransmission& tx) {
+  history[stats.transmissions % SIM_MAX_TRANSMISSIONS] = tx;
+  lastTx = tx;
+  stats.transmissions++;
+  stats.txAirtimeUs += tx.airtimeUs;
+  if (tx.join) {
+    stats.joinRequests++;
+  }
+}
+
+bool SimRadio::receive(uint8_t window, SimDownlink& downlink) {
+  memset(&downlink, 0, sizeof(downlink));
+  downlink.window = window;
+
+  if (lastTx.join) {
+    if (joinAccept.attempt == 0 || stats.joinRequests < joinAccept.attempt || window != joinAccept.window) {
+      return false;
+    }
+    downlink.joinAccept = true;
+    return true;
+  }
+
+  // Betiklenmiş yanıt: RX2 uplink'in son penceresidir, orada tüketilir
+  if (downlinkCount > 0 && downlinks[0].scripted) {
+    bool match = downlinks[0].window == window;
+    if (match) {
+      downlink = downlinks[0];
+    }
+    if (match || window == 2) {
+      downlinkCount--;
+      memmove(downlinks, downlinks + 1, downlinkCount * sizeof(SimDownlink));
+    }
+    return match;
+  }
+
+  bool ack = lastTx.confirmed && ackConfirmed;
+  if (downlinkCount > 0 && downlinks[0].window == window) {
+    downlink = downlinks[0];
+    downlink.ack = ack;
+    downlinkCount--;
+    memmove(downlinks, downlinks + 1, downlinkCount * sizeof(SimDownlink));
+    return true;
+  }
+
+  // Bekleyen veri yoksa ACK boş bir çerçeveyle RX1'de gelir
+  if (ack && window == 1) {
+    downlink.ack = true;
+    return true;
+  }
+  return false;
+}
+
+void SimRadio::onRxWindow(uint32_t onUs, bool received, bool missed) {
+  stats.rxWindows++;
+  stats.rxOnUs += onUs;
+  if (received) {
+    stats.downlinks++;
+  }
+  if (missed) {
+    stats.missedDownlinks++;
+  }
+}
+
+const SimRadioStats& SimRadio::getStats() {
+  return stats;
+}
+
+uint32_t SimRadio::transmissionCount() {
+  return stats.transmissions;
+}
+
+const SimTransmission& SimRadio::transmission(uint32_t index) {
+  uint32_t first = stats.transmissions > SIM_MAX_TRANSMISSIONS ? stats.transmissions - SIM_MAX_TRANSMISSIONS : 0;
+  return history[(first + index) % SIM_MAX_TRANSMISSIONS];
+}
+
+uint8_t SimRadio::pendingDownlinks() {
+  return downlinkCount;
+}
@@ -0,0 +1,123 @@
+#ifndef SIM_RADIO_H
+#define SIM_RADIO_H
+
+#include <stdint.h>
+#include <lmic.h>
+
+// Simüle edilmiş SX1276 ve ağ sunucusu
+//
+// LMIC modeli (SimLmic.cpp) her iletimi onTransmit() ile bildirir ve her
+// RX penceresinde receive() ile bu pencerede bir çerçeve olup olmadığını
+// sorar. Ağ tarafı betiklenir: join-accept'in kaçıncı join isteğine ve
+// hangi pencerede geleceği, sıradaki uplink'lerin pencerelerine konacak
+// downlink'ler, onaylı uplink'lere ACK verilip verilmeyeceği ve downlink
+// önsözünün beklenen zamana göre kayması (cihaz saat hatası).
+
+#define SIM_MAX_TRANSMISSIONS 256   // Kaydedilen son iletim sayısı
+#define SIM_MAX_DOWNLINKS     16    // Bekleyen betiklenmiş downlink
+#define SIM_DOWNLINK_MAX      64    // Betiklenmiş downlink yükü (byte)
+
+// Radyonun yaptığı tek iletim
+struct SimTransmission {
+  uint64_t startUs;
+  uint32_t airtimeUs;
+  uint32_t freq;
+  rps_t rps;
+  uint8_t datarate;
+  uint8_t length;       // PHY çerçeve boyutu
+  uint8_t port;         // Join isteğinde 0
+  bool join;
+  bool confirmed;
+};
+
+// Join-accept içeriği (DLSettings, RxDelay ve EU benzeri bölgelerde CFList)
+struct SimJoinAccept {
+  uint16_t attempt;     // Kabul edilecek join isteği (1'den); 0: hiç yanıt yok
+  uint8_t window;       // 1: RX1, 2: RX2
+  devaddr_t devAddr;
+  uint32_t netId;
+  uint8_t rxDelay;
+  uint8_t rx1DrOffset;
+  uint8_t rx2Dr;
+  bool cfList;          // EU benzeri: 3-7 kanallarını ekle
+  uint32_t cfListFreq[5]; // CFList frekansları (Hz); 0 olan kanal eklenmez
+};
+
+// Pencerede alınan çerçeve
+struct SimDownlink {
+  uint8_t window;       // 1: RX1, 2: RX2
+  uint8_t port;         // 0: yalnızca ACK/MAC
+  uint8_t length;
+  uint8_t data[SIM_DOWNLINK_MAX];
+  bool ack;
+  bool joinAccept;
+  bool scripted;        // queueResponse: pencere ve ACK tam olarak betikten
+};
+
+struct SimRadioStats {
+  uint32_t transmissions;
+  uint32_t joinRequests;
+  uint64_t txAirtimeUs;
+  uint32_t rxWindows;
+  uint64_t rxOnUs;          // Pencerelerde alıcının açık kaldığı toplam süre
+  uint32_t downlinks;       // Teslim edilen çerçeve (join-accept dahil)
+  uint32_t missedDownlinks; // Önsöz pencerenin dışında kaldığı için kaçan çerçeve
+};
+
+class SimRadio {
+public:
+  // Betiği ve sayaçları temizle; varsayılan ağ: ilk join isteği RX1'de kabul
+  static void reset();
+
+  static void scriptJoinAccept(const SimJoinAccept& accept);
+  static SimJoinAccept defaultJoinAccept();
+  static const SimJoinAccept& getJoinAccept();
+
+  // Sıradaki uplink'in verilen penceresinde gönderilecek downlink
+  static bool queueDownlink(uint8_t port, const uint8_t* data, uint8_t length, uint8_t window = 1);
+
+  // Sıradaki veri uplink'inin yanıtını tam olarak betikle (iz oynatma):
+  // window 0 ise hiçbir pencerede çerçeve gelmez; ACK setAckConfirmed'den
+  // bağımsızdır. Yanıt, uplink'in son penceresinde tüketilir
+  static bool queueResponse(uint8_t window, bool ack, uint8_t port, const uint8_t* data, uint8_t length);
+
+  // Onaylı uplink'lere ACK verilsin mi (varsayılan evet)
+  static void setAckConfirmed(bool enabled);
+
+  // Downlink önsözünün beklenen açılış anına göre kayması (µs, + geç)
+  static void setTimingOffsetUs(int32_t offsetUs);
+  static int32_t getTimingOffsetUs();
+
+  // ---- LMIC modelinin çağırdıkları ----
+
+  static void onTransmit(const SimTransmission& tx);
+
+  // Penceredeki çerçeve; yoksa false
+  static bool receive(uint8_t window, SimDownlink& downlink);
+
+  // Kapanan pencere: alıcının açık kaldığı süre, çerçeve alındı mı, gönderilen
+  // çerçeve önsöz pencereye denk gelmediği için kaçırıldı mı
+  static void onRxWindow(uint32_t onUs, bool received, bool missed);
+
+  // ---- Kayıtlar ----
+
+  static const SimRadioStats& getStats();
+  static uint32_t transmissionCount();
+
+  // index: 0 en eski kayıtlı iletim
+  static const SimTransmission& transmission(uint32_t index);
+
+  static uint8_t pendingDownlinks();
+
+private:
+  static SimJoinAccept joinAccept;
+  static SimDownlink downlinks[SIM_MAX_DOWNLINKS];
+  static uint8_t downlinkCount;
+  static bool ackConfirmed;
+  static int32_t timingOffsetUs;
+  static SimTransmission history[SIM_MAX_TRANSMISSIONS];
+  static SimTransmission lastTx;
+  static SimRadioStats stats;
+};
+
+#endif // SIM_RADIO_H
@@ -0,0 +1,157 @@
+#include "SimTrace.h"
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "SimRadio.h"
+
+SimTrace::SimTrace() : count(0) {
+  memset(&header, 0, sizeof(header));
+}
+
+bool SimTrace::load(const uint8_t* data, size_t length) {
+  // Kayıtta birden fazla döküm olabilir; sonuncusu kullanılır
+  bool found = false;
+  for (size_t i = 0; i + sizeof(TraceDumpHeader) <= length; i++) {
+    TraceDumpHeader h;
+    memcpy(&h, data + i, sizeof(h));
+    if (h.magic != TRACE_DUMP_MAGIC || h.version != TRACE_DUMP_VERSION ||
+        h.recordSize != sizeof(TraceRecord) || h.osTicksPerSec == 0) {
+      continue;
+    }
+    size_t bodySize = (size_t)h.count * sizeof(TraceRecord);
+    if (i + sizeof(h) + bodySize > length) {
+      break;
+    }
+
+    std::vector<TraceRecord> records(h.count);
+    if (bodySize) {
+      memcpy(records.data(), data + i + sizeof(h), bodySize);
+    }
+    header = h;
+    parse(records.data(), h.count);
+    found = true;
+  }
+  return found;
+}
+
+bool SimTrace::loadFile(const char* path) {
+  FILE* in = fopen(path, "rb");
+  if (!in) {
+    return false;
+  }
+  std::vector<uint8_t> data;
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), in)) > 0) {
+    data.insert(data.end(), chunk, chunk + n);
+  }
+  fclose(in);
+  return load(data.data(), data.size());
+}
+
+const TraceDumpHeader& SimTrace::getHeader() const {
+  return header;
+}
+
+uint16_t SimTrace::uplinkCount() const {
+  return count;
+}
+
+const SimTraceUplink& SimTrace::uplink(uint16_t index) const {
+  return uplinks[index < count ? index : 0];
+}
+
+bool SimTrace::scriptJoin() const {
+  uint16_t joinRequests = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    const SimTraceUplink& u = uplinks[i];
+    if (!u.join) {
+      continue;
+    }
+    joinRequests++;
+    if (u.completed && u.result == EV_JOINED) {
+      SimJoinAccept accept = SimRadio::defaultJoinAccept();
+      accept.attempt = joinRequests;
+      accept.window = u.window ? u.window : 1;
+      accept.rxDelay = u.rxDelay;
+      SimRadio::scriptJoinAccept(accept);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool SimTrace::queueResponse(uint16_t index, uint8_t downlinkPort) const {
+  if (index >= count) {
+    return false;
+  }
+  const SimTraceUplink& u = uplinks[index];
+  if (u.join || !u.completed || u.result != EV_TXCOMPLETE) {
+    return false;
+  }
+
+  static const uint8_t zeros[SIM_DOWNLINK_MAX] = { 0 };
+  bool ack = (u.txrxFlags & TXRX_ACK) != 0;
+  uint8_t port = (u.txrxFlags & TXRX_PORT) ? downlinkPort : 0;
+  return SimRadio::queueResponse(u.window, ack, port, zeros, port ? u.downlinkLen : 0);
+}
+
+int SimTrace::firstMismatch(const SimTrace& other) const {
+  const uint8_t resultFlags = TXRX_ACK | TXRX_NACK | TXRX_PORT | TXRX_NOPORT;
+  uint16_t common = count < other.count ? count : other.count;
+  for (uint16_t i = 0; i < common; i++) {
+    const SimTraceUplink& a = uplinks[i];
+    const SimTraceUplink& b = other.uplinks[i];
+    if (a.join != b.join || a.completed != b.completed || a.result != b.result ||
+        a.window != b.window || a.downlinkLen != b.downlinkLen ||
+        (a.txrxFlags & resultFlags) != (b.txrxFlags & resultFlags)) {
+      return i;
+    }
+  }
+  return count == other.count ? -1 : common;
+}
+
+void SimTrace::parse(const TraceRecord* records, uint16_t recordCount) {
+  count = 0;
+  uint32_t t0 = recordCount ? records[0].timestampMs : 0;
+  SimTraceUplink* current = nullptr;
+
+  for (uint16_t i = 0; i < recordCount; i++) {
+    const TraceRecord& r = records[i];
+    switch (r.ev) {
+      case EV_TXSTART:
+        if (count >= SIM_TRACE_MAX_UPLINKS) {
+          return;
+        }
+        current = &uplinks[count++];
+        memset(current, 0, sizeof(*current));
+        current->atMs = r.timestampMs - t0;
+        current->length = r.dataLen;
+        current->join = (r.opmode & OP_JOINING) != 0;
+        break;
+
+      case EV_TXCOMPLETE:
+      case EV_JOIN_TXCOMPLETE:
+      case EV_JOINED:
+        // Döküm bir iletimin ortasından başlıyorsa sonucu sahipsizdir
+        if (!current || current->completed) {
+          break;
+        }
+        current->completed = true;
+        current->result = r.ev;
+        current->txrxFlags = r.txrxFlags;
+        current->window = (r.txrxFlags & TXRX_DNW1) ? 1 : (r.txrxFlags & TXRX_DNW2) ? 2 : 0;
+        current->downlinkLen = r.ev == EV_TXCOMPLETE ? r.dataLen : 0;
+        current->rxDelay = r.rxDelay;
+        break;
+
+      case EV_TXCANCELED:
+      case EV_RESET:
+        current = nullptr;
+        break;
+
+      default:
+        break;
+    }
+  }
+}
@@ -0,0 +1,63 @@
+#ifndef SIM_TRACE_H
+#define SIM_TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../../Core/Lora/EventTraceFormat.h"
+
+// TRACE_DUMP kaydını simüle radyoya geri oynatma
+//
+// Cihazdan alınan ikili döküm (tools/trace_view ile aynı biçim) uplink
+// başına özetlenir: iletimin zamanı ve boyutu, join isteği mi, sonuçta
+// hangi pencerede çerçeve geldiği, ACK/NACK ve downlink yük boyutu.
+// scriptJoin() ve queueResponse() bu özeti SimRadio betiğine çevirir; aynı
+// uygulama akışı simülasyonda koşturulup yeni iz firstMismatch() ile
+// kayıtla karşılaştırılır. Yük içeriği izde olmadığı için downlink'ler
+// kayıttaki boyutta sıfır byte olarak üretilir.
+
+#define SIM_TRACE_MAX_UPLINKS 64
+
+struct SimTraceUplink {
+  uint32_t atMs;         // İlk kayda göre TX başlangıcı (Utils::getTimestamp)
+  uint8_t length;        // PHY çerçeve boyutu (EV_TXSTART anındaki LMIC.dataLen)
+  bool join;
+  bool completed;        // Sonuç olayı (EV_TXCOMPLETE/EV_JOIN_TXCOMPLETE/EV_JOINED) izde var
+  uint8_t result;        // Sonuç olayı (ev_t)
+  uint8_t txrxFlags;
+  uint8_t window;        // Çerçevenin alındığı pencere (0: yok)
+  uint8_t downlinkLen;   // Alınan uygulama yükü
+  uint8_t rxDelay;       // Sonuç anındaki LMIC.rxDelay (sn)
+};
+
+class SimTrace {
+public:
+  SimTrace();
+
+  // Ham kayıtta son dökümü bul ve uplink'leri çıkar
+  bool load(const uint8_t* data, size_t length);
+  bool loadFile(const char* path);
+
+  const TraceDumpHeader& getHeader() const;
+  uint16_t uplinkCount() const;
+  const SimTraceUplink& uplink(uint16_t index) const;
+
+  // Kabul edilen join isteği varsa SimRadio'nun join-accept'ini ona göre kur
+  // (kaçıncı istek, pencere, RX1 gecikmesi); yoksa false
+  bool scriptJoin() const;
+
+  // Veri uplink'inin ağ yanıtını SimRadio'ya sıradaki yanıt olarak ekle
+  bool queueResponse(uint16_t index, uint8_t downlinkPort = 1) const;
+
+  // Uplink sonuçlarını (tip, pencere, ACK/NACK, yük boyutu) karşılaştır;
+  // ilk farklı uplink'in indeksi, aynıysa -1
+  int firstMismatch(const SimTrace& other) const;
+
+private:
+  TraceDumpHeader header;
+  SimTraceUplink uplinks[SIM_TRACE_MAX_UPLINKS];
+  uint16_t count;
+
+  void parse(const TraceRecord* records, uint16_t recordCount);
+};
+
+#endif // SIM_TRACE_H
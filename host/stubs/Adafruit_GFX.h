@@ -0,0 +1,25 @@
+#ifndef HOST_ADAFRUIT_GFX_H
+#define HOST_ADAFRUIT_GFX_H
+
+#include "Arduino.h"
+
+// Metin imleci ve boyutu; çizim yapılmaz, yazılan karakterler çerçeve
+// belleğine basit bir izle işlenir (değişen bölge aktarımını sınamak için)
+class Adafruit_GFX : public Print {
+public:
+  Adafruit_GFX(int16_t w, int16_t h) : width(w), height(h), cursorX(0), cursorY(0), textSize(1) {}
+
+  void setCursor(int16_t x, int16_t y) { cursorX = x; cursorY = y; }
+  void setTextSize(uint8_t size) { textSize = size ? size : 1; }
+  void setTextColor(uint16_t color) { (void)color; }
+  void cp437(bool enabled = true) { (void)enabled; }
+
+protected:
+  int16_t width;
+  int16_t height;
+  int16_t cursorX;
+  int16_t cursorY;
+  uint8_t textSize;
+};
+
+#endif // HOST_ADAFRUIT_GFX_H
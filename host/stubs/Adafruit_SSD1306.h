@@ -0,0 +1,64 @@
+#ifndef HOST_ADAFRUIT_SSD1306_H
+#define HOST_ADAFRUIT_SSD1306_H
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "Adafruit_GFX.h"
+
+#define SSD1306_SWITCHCAPVCC 0x02
+#define SSD1306_WHITE        1
+#define WHITE                SSD1306_WHITE
+#define SSD1306_DISPLAYOFF   0xAE
+#define SSD1306_DISPLAYON    0xAF
+#define SSD1306_COLUMNADDR   0x21
+#define SSD1306_PAGEADDR     0x22
+
+// SSD1306 yedeği: çerçeve belleği tutulur, her karakter 6 sütunluk bir
+// desen olarak yazılır; I2C aktarımı DisplayManager'ın kendisi yapar
+class Adafruit_SSD1306 : public Adafruit_GFX {
+public:
+  Adafruit_SSD1306(int16_t w, int16_t h, TwoWire* wire = &Wire, int8_t rst = -1) :
+    Adafruit_GFX(w, h) {
+    (void)wire;
+    (void)rst;
+    buffer = new uint8_t[w * ((h + 7) / 8)]();
+  }
+
+  ~Adafruit_SSD1306() { delete[] buffer; }
+
+  bool begin(uint8_t vcs = SSD1306_SWITCHCAPVCC, uint8_t addr = 0, bool reset = true, bool periphBegin = true) {
+    (void)vcs; (void)addr; (void)reset; (void)periphBegin;
+    return true;
+  }
+
+  void clearDisplay() { memset(buffer, 0, width * ((height + 7) / 8)); }
+  void display() {}
+  void ssd1306_command(uint8_t command) { (void)command; }
+  uint8_t* getBuffer() { return buffer; }
+
+  using Print::write;
+  size_t write(uint8_t c) override {
+    if (c == '\n') {
+      cursorX = 0;
+      cursorY += 8 * textSize;
+      return 1;
+    }
+    if (c == '\r') {
+      return 1;
+    }
+    int16_t page = cursorY / 8;
+    for (uint8_t col = 0; col < 6 && page < (height + 7) / 8; col++) {
+      int16_t x = cursorX + col;
+      if (x >= 0 && x < width) {
+        buffer[page * width + x] = col < 5 ? (uint8_t)(c * 31 + col) : 0;
+      }
+    }
+    cursorX += 6 * textSize;
+    return 1;
+  }
+
+private:
+  uint8_t* buffer;
+};
+
+#endif // HOST_ADAFRUIT_SSD1306_H
@@ -0,0 +1,127 @@
+#include "Arduino.h"
+#include "Wire.h"
+#include "SPI.h"
+#include <chrono>
+#include <thread>
+
+HardwareSerial Serial;
+TwoWire Wire;
+SPIClass SPI;
+
+static std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+static unsigned long randomState = 1;
+
+uint32_t millis() {
+  return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::steady_clock::now() - startTime).count();
+}
+
+uint32_t micros() {
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - startTime).count();
+}
+
+void delay(uint32_t ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  (void)pin;
+  (void)value;
+}
+
+// Tekrarlanabilir simülasyon için sabit tohumlu LCG (Arduino random() aralık anlamıyla)
+long random(long max) {
+  if (max <= 0) {
+    return 0;
+  }
+  randomState = randomState * 1103515245UL + 12345UL;
+  return (long)((randomState >> 16) & 0x7FFFFFFF) % max;
+}
+
+long random(long min, long max) {
+  return max <= min ? min : min + random(max - min);
+}
+
+void randomSeed(unsigned long seed) {
+  randomState = seed ? seed : 1;
+}
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+  size_t n = 0;
+  while (size--) {
+    n += write(*buffer++);
+  }
+  return n;
+}
+
+size_t Print::print(long value, int base) {
+  if (base == DEC || value >= 0) {
+    char text[24];
+    snprintf(text, sizeof(text), base == HEX ? "%lX" : "%ld", value);
+    return write(text);
+  }
+  return print((unsigned long)value, base);
+}
+
+size_t Print::print(unsigned long value, int base) {
+  char text[24];
+  snprintf(text, sizeof(text), base == HEX ? "%lX" : "%lu", value);
+  return write(text);
+}
+
+size_t Print::print(double value, int digits) {
+  char text[48];
+  snprintf(text, sizeof(text), "%.*f", digits, value);
+  return write(text);
+}
+
+HardwareSerial::HardwareSerial() :
+  echo(true),
+  inputHead(0),
+  inputTail(0) {
+}
+
+void HardwareSerial::flush() {
+  fflush(stdout);
+}
+
+int HardwareSerial::available() {
+  return (int)(inputHead - inputTail);
+}
+
+int HardwareSerial::read() {
+  if (inputTail == inputHead) {
+    return -1;
+  }
+  return (uint8_t)input[inputTail++ % sizeof(input)];
+}
+
+void HardwareSerial::setEcho(bool enabled) {
+  echo = enabled;
+}
+
+void HardwareSerial::feed(const char* text) {
+  while (*text && inputHead - inputTail < sizeof(input)) {
+    input[inputHead++ % sizeof(input)] = *text++;
+  }
+}
+
+size_t HardwareSerial::write(uint8_t value) {
+  if (echo) {
+    fputc(value, stdout);
+  }
+  return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+  if (echo) {
+    fwrite(buffer, 1, size, stdout);
+  }
+  return size;
+}
@@ -0,0 +1,99 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Host (Linux) derlemesi için Arduino çekirdeği yedeği
+//
+// Yalnızca depodaki kodun kullandığı alt küme: Print/Serial, zaman
+// fonksiyonları, pin ve rastgele sayı çağrıları. Serial çıktısı stdout'a
+// yazılır (setEcho(false) ile susturulabilir), girdi feed() ile verilir.
+// millis()/micros()/delay() gerçek (monoton) zamandır; simülasyonun sanal
+// saati Utils::setClock() ve LMIC'in os_getTime()'ı üzerinden bağlanır.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#define PROGMEM
+#define memcpy_P memcpy
+
+#define DEC 10
+#define HEX 16
+
+#define INPUT  0x01
+#define OUTPUT 0x03
+#define LOW    0
+#define HIGH   1
+
+class __FlashStringHelper;
+#define F(text) (reinterpret_cast<const __FlashStringHelper*>(text))
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+class Print {
+public:
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t value) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size);
+  virtual int availableForWrite() { return 0x7FFF; }
+
+  size_t write(const char* text) { return text ? write((const uint8_t*)text, strlen(text)) : 0; }
+
+  size_t print(const __FlashStringHelper* text) { return write((const char*)text); }
+  size_t print(const char* text) { return write(text); }
+  size_t print(char value) { return write((uint8_t)value); }
+  size_t print(unsigned char value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(int value, int base = DEC) { return print((long)value, base); }
+  size_t print(unsigned int value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(long value, int base = DEC);
+  size_t print(unsigned long value, int base = DEC);
+  size_t print(double value, int digits = 2);
+
+  template <typename T>
+  size_t println(const T& value) { size_t n = print(value); return n + println(); }
+  template <typename T>
+  size_t println(const T& value, int format) { size_t n = print(value, format); return n + println(); }
+  size_t println() { return write((const uint8_t*)"\r\n", 2); }
+};
+
+// stdout'a yazan ve feed() ile verilen girdiyi okuyan seri port
+class HardwareSerial : public Print {
+public:
+  HardwareSerial();
+
+  void begin(unsigned long baud) { (void)baud; }
+  void flush();
+
+  int available();
+  int read();
+
+  // Host testleri: çıktıyı sustur/aç, okunacak girdiyi ekle
+  void setEcho(bool enabled);
+  void feed(const char* text);
+
+  using Print::write;
+  size_t write(uint8_t value) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+
+private:
+  bool echo;
+  char input[256];
+  size_t inputHead;
+  size_t inputTail;
+};
+
+extern HardwareSerial Serial;
+
+#endif // HOST_ARDUINO_H
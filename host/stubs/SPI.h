@@ -0,0 +1,16 @@
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include "Arduino.h"
+
+// SPI yedeği; radyo simülasyonu LMIC seviyesinde yapıldığı için yazmaç erişimi yoktur
+class SPIClass {
+public:
+  void begin(int sck = -1, int miso = -1, int mosi = -1, int ss = -1) {
+    (void)sck; (void)miso; (void)mosi; (void)ss;
+  }
+};
+
+extern SPIClass SPI;
+
+#endif // HOST_SPI_H
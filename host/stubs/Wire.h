@@ -0,0 +1,26 @@
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include "Arduino.h"
+
+// I2C yedeği: aktarılan byte'ları sayar (ekran aktarım ölçümleri için)
+class TwoWire {
+public:
+  TwoWire() : clock(100000), bytesWritten(0), transmissions(0) {}
+
+  void begin(int sda = -1, int scl = -1) { (void)sda; (void)scl; }
+  void setClock(uint32_t frequency) { clock = frequency; }
+
+  void beginTransmission(uint8_t address) { (void)address; transmissions++; }
+  size_t write(uint8_t value) { (void)value; bytesWritten++; return 1; }
+  size_t write(const uint8_t* data, size_t size) { (void)data; bytesWritten += size; return size; }
+  uint8_t endTransmission(bool stop = true) { (void)stop; return 0; }
+
+  uint32_t clock;
+  uint32_t bytesWritten;
+  uint32_t transmissions;
+};
+
+extern TwoWire Wire;
+
+#endif // HOST_WIRE_H
@@ -0,0 +1,17 @@
+#ifndef HOST_LMIC_HAL_H
+#define HOST_LMIC_HAL_H
+
+#include <stdint.h>
+
+// LMIC HAL pin eşlemesi; host simülasyonunda pinler kullanılmaz
+#define LMIC_UNUSED_PIN 0xff
+#define NUM_DIO 3
+
+struct lmic_pinmap {
+  uint8_t nss;
+  uint8_t rxtx;
+  uint8_t rst;
+  uint8_t dio[NUM_DIO];
+};
+
+#endif // HOST_LMIC_HAL_H
@@ -0,0 +1,255 @@
+#ifndef HOST_LMIC_H
+#define HOST_LMIC_H
+
+// MCCI LMIC API'sinin host (Linux) davranış modeli
+//
+// Gerçek kütüphanenin yerine geçmez; depodaki kodun kullandığı tipler,
+// alanlar ve çağrılar aynı adlarla tanımlanır ve host/sim/SimLmic.cpp
+// içinde sanal saatte çalışan basit bir MAC katmanıyla uygulanır: join
+// isteği ve uplink'in yayın süresi, RX1/RX2 pencereleri (EV_RXSTART),
+// görev döngüsü bantları ve SimRadio'nun betiklediği join-accept ve
+// downlink'ler. MAC komutları, şifreleme ve MIC modellenmez.
+//
+// Bölge CFG_* ile seçilir (varsayılan CFG_eu868); EU868 benzeri bölgeler
+// kanal tablosu, US915 sabit 72 kanallı maske düzenini kullanır.
+
+#include <stdint.h>
+#include <string.h>
+
+#if !defined(CFG_eu868) && !defined(CFG_us915) && !defined(CFG_au915) && \
+    !defined(CFG_as923) && !defined(CFG_kr920) && !defined(CFG_in866)
+#define CFG_eu868 1
+#endif
+
+#if defined(CFG_us915) || defined(CFG_au915)
+#define CFG_LMIC_US_like 1
+#define CFG_LMIC_EU_like 0
+#else
+#define CFG_LMIC_US_like 0
+#define CFG_LMIC_EU_like 1
+#endif
+
+typedef uint8_t  u1_t;
+typedef int8_t   s1_t;
+typedef uint16_t u2_t;
+typedef int16_t  s2_t;
+typedef uint32_t u4_t;
+typedef int32_t  s4_t;
+typedef u1_t     bit_t;
+typedef u1_t*    xref2u1_t;
+typedef const u1_t* xref2cu1_t;
+
+typedef s4_t ostime_t;
+typedef u4_t devaddr_t;
+typedef u1_t dr_t;
+typedef u2_t rps_t;
+typedef u1_t cr_t;
+typedef u1_t sf_t;
+typedef u1_t bw_t;
+
+// ---- Zaman ----
+
+#define US_PER_OSTICK_EXPONENT 4
+#define US_PER_OSTICK          (1 << US_PER_OSTICK_EXPONENT)
+#define OSTICKS_PER_SEC        (1000000 / US_PER_OSTICK)
+
+#define us2osticks(us)   ((ostime_t)(((int64_t)(us) * OSTICKS_PER_SEC) / 1000000))
+#define ms2osticks(ms)   ((ostime_t)(((int64_t)(ms) * OSTICKS_PER_SEC) / 1000))
+#define sec2osticks(sec) ((ostime_t)((int64_t)(sec) * OSTICKS_PER_SEC))
+#define osticks2ms(os)   ((s4_t)(((os) * (int64_t)1000) / OSTICKS_PER_SEC))
+#define osticks2us(os)   ((s4_t)(((os) * (int64_t)1000000) / OSTICKS_PER_SEC))
+
+#define MAX_CLOCK_ERROR 65536
+
+// ---- Radyo parametreleri (rps_t) ----
+
+enum _cr_t { CR_4_5 = 0, CR_4_6, CR_4_7, CR_4_8 };
+enum _sf_t { FSK = 0, SF7, SF8, SF9, SF10, SF11, SF12, SFrfu };
+enum _bw_t { BW125 = 0, BW250, BW500, BWrfu };
+
+inline sf_t getSf(rps_t params)   { return (sf_t)(params & 0x7); }
+inline bw_t getBw(rps_t params)   { return (bw_t)((params >> 3) & 0x3); }
+inline cr_t getCr(rps_t params)   { return (cr_t)((params >> 5) & 0x3); }
+inline int  getNocrc(rps_t params) { return (params >> 7) & 0x1; }
+inline int  getIh(rps_t params)   { return (params >> 8) & 0xFF; }
+
+inline rps_t makeRps(sf_t sf, bw_t bw, cr_t cr, int ih, int nocrc) {
+  return (rps_t)((sf & 7) | ((bw & 3) << 3) | ((cr & 3) << 5) | (nocrc ? (1 << 7) : 0) | ((ih & 0xFF) << 8));
+}
+
+#define DR_RANGE_MAP(drlo, drhi) (((u2_t)0xFFFF << (drlo)) & ((u2_t)0xFFFF >> (15 - (drhi))))
+
+#if CFG_LMIC_US_like
+enum _dr_us915_t {
+  DR_SF10 = 0, DR_SF9, DR_SF8, DR_SF7, DR_SF8C, DR_NONE,
+  DR_SF12CR = 8, DR_SF11CR, DR_SF10CR, DR_SF9CR, DR_SF8CR, DR_SF7CR
+};
+#define MAX_CHANNELS   72
+#define MAX_XCHANNELS  2
+#else
+enum _dr_eu868_t {
+  DR_SF12 = 0, DR_SF11, DR_SF10, DR_SF9, DR_SF8, DR_SF7, DR_SF7B, DR_FSK, DR_NONE
+};
+#define MAX_CHANNELS   16
+#endif
+
+enum { BAND_MILLI = 0, BAND_CENTI = 1, BAND_DECI = 2, BAND_AUX = 3 };
+#define MAX_BANDS 4
+
+// Veri hızından (uplink) radyo parametrelerine
+rps_t updr2rps(dr_t datarate);
+
+// ---- Olaylar ve durum bayrakları ----
+
+enum _ev_t {
+  EV_SCAN_TIMEOUT = 1, EV_BEACON_FOUND, EV_BEACON_MISSED, EV_BEACON_TRACKED,
+  EV_JOINING, EV_JOINED, EV_RFU1, EV_JOIN_FAILED, EV_REJOIN_FAILED,
+  EV_TXCOMPLETE, EV_LOST_TSYNC, EV_RESET, EV_RXCOMPLETE, EV_LINK_DEAD,
+  EV_LINK_ALIVE, EV_SCAN_FOUND, EV_TXSTART, EV_TXCANCELED, EV_RXSTART,
+  EV_JOIN_TXCOMPLETE
+};
+typedef enum _ev_t ev_t;
+
+enum {
+  OP_NONE     = 0x0000,
+  OP_SCAN     = 0x0001,
+  OP_TRACK    = 0x0002,
+  OP_JOINING  = 0x0004,
+  OP_TXDATA   = 0x0008,
+  OP_POLL     = 0x0010,
+  OP_REJOIN   = 0x0020,
+  OP_SHUTDOWN = 0x0040,
+  OP_TXRXPEND = 0x0080,
+  OP_RNDTX    = 0x0100,
+  OP_PINGINI  = 0x0200,
+  OP_PINGABLE = 0x0400,
+  OP_NEXTCHNL = 0x0800,
+  OP_LINKDEAD = 0x1000,
+  OP_TESTMODE = 0x2000,
+  OP_UNJOIN   = 0x4000
+};
+
+enum {
+  TXRX_ACK    = 0x80,
+  TXRX_NACK   = 0x40,
+  TXRX_NOPORT = 0x20,
+  TXRX_PORT   = 0x10,
+  TXRX_LENERR = 0x08,
+  TXRX_PING   = 0x04,
+  TXRX_DNW2   = 0x02,
+  TXRX_DNW1   = 0x01
+};
+
+// ---- İş zamanlayıcı ----
+
+struct osjob_t;
+typedef void osjobcb_t(struct osjob_t*);
+
+struct osjob_t {
+  struct osjob_t* next;
+  ostime_t deadline;
+  osjobcb_t* func;
+};
+
+// ---- LMIC durumu ----
+
+#define MAX_LEN_PAYLOAD 255
+#define MAX_LEN_FRAME   255
+
+struct band_t {
+  u2_t txcap;       // Görev döngüsü böleni
+  s1_t txpow;
+  u1_t lastchnl;
+  ostime_t avail;   // Bandın tekrar kullanılabileceği zaman
+};
+
+typedef void lmic_event_cb_t(void* pUserData, ev_t ev);
+
+struct lmic_t {
+  osjob_t osjob;
+
+  ostime_t txend;
+  ostime_t rxtime;
+  u4_t freq;
+  s1_t rssi;
+  s1_t snr;
+  rps_t rps;
+  u1_t rxsyms;
+  u1_t dndr;
+  s1_t txpow;
+
+  ostime_t globalDutyAvail;
+#if CFG_LMIC_EU_like
+  band_t bands[MAX_BANDS];
+  u4_t channelFreq[MAX_CHANNELS];
+  u2_t channelDrMap[MAX_CHANNELS];
+  u2_t channelMap;
+#else
+  u4_t xchFreq[MAX_XCHANNELS];
+  u2_t channelMap[(MAX_CHANNELS + 15) / 16];
+#endif
+  u1_t txChnl;
+
+  u4_t netid;
+  u2_t opmode;
+  s1_t adrTxPow;
+  u1_t datarate;
+  u2_t clockError;
+  u1_t pendTxPort;
+  u1_t pendTxConf;
+  u1_t pendTxLen;
+  u1_t pendTxData[MAX_LEN_PAYLOAD];
+  u2_t devNonce;
+  u1_t nwkKey[16];
+  u1_t artKey[16];
+  devaddr_t devaddr;
+  u4_t seqnoDn;
+  u4_t seqnoUp;
+  u1_t rxDelay;
+  u1_t adrEnabled;
+  u1_t dn2Dr;
+  u4_t dn2Freq;
+  u1_t rx1DrOffset;
+  u1_t txCnt;
+  u1_t txrxFlags;
+  u1_t dataBeg;
+  u1_t dataLen;
+  u1_t frame[MAX_LEN_FRAME];
+
+  lmic_event_cb_t* eventCb;
+  void* eventUserData;
+};
+
+extern lmic_t LMIC;
+
+// ---- API ----
+
+int os_init_ex(const void* pintab);
+void os_runloop_once();
+ostime_t os_getTime();
+void os_setCallback(osjob_t* job, osjobcb_t* cb);
+void os_setTimedCallback(osjob_t* job, ostime_t time, osjobcb_t* cb);
+void os_clearCallback(osjob_t* job);
+bit_t os_queryTimeCriticalJobs(ostime_t time);
+
+// Uygulamanın sağladığı kimlik bilgileri (AppConfig.h)
+void os_getArtEui(u1_t* buf);
+void os_getDevEui(u1_t* buf);
+void os_getDevKey(u1_t* buf);
+
+void LMIC_reset();
+void LMIC_shutdown();
+int LMIC_registerEventCb(lmic_event_cb_t* pEventCb, void* pUserData);
+bit_t LMIC_startJoining();
+int LMIC_setTxData2(u1_t port, xref2u1_t data, u1_t dlen, u1_t confirmed);
+void LMIC_setDrTxpow(dr_t dr, s1_t txpow);
+void LMIC_setAdrMode(bit_t enabled);
+void LMIC_setLinkCheckMode(bit_t enabled);
+void LMIC_setClockError(u2_t error);
+bit_t LMIC_setupChannel(u1_t channel, u4_t freq, u2_t drmap, s1_t band);
+bit_t LMIC_enableChannel(u1_t channel);
+bit_t LMIC_disableChannel(u1_t channel);
+void LMIC_setSession(u4_t netid, devaddr_t devaddr, xref2u1_t nwkKey, xref2u1_t artKey);
+void LMIC_getSessionKeys(u4_t* netid, devaddr_t* devaddr, xref2u1_t nwkKey, xref2u1_t artKey);
+
+#endif // HOST_LMIC_H
@@ -0,0 +1,66 @@
+#include "../Features/Messaging/ConfirmPolicy.h"
+
+ConfirmPolicy::ConfirmPolicy() :
+  framesSinceConfirm(0),
+  ackRate(256) {
+  memset(&stats, 0, sizeof(stats));
+  stats.ackInterval = CONFIRM_INTERVAL_DEFAULT;
+  stats.ackRatePercent = 100;
+}
+
+bool ConfirmPolicy::shouldConfirm(bool critical) {
+  if (critical) {
+    return true;
+  }
+  return framesSinceConfirm + 1 >= stats.ackInterval;
+}
+
+void ConfirmPolicy::onSent(bool confirmed, uint32_t airtimeMs, uint32_t ackAirtimeMs) {
+  if (confirmed) {
+    stats.confirmedSent++;
+    framesSinceConfirm = 0;
+    return;
+  }
+  
+  stats.unconfirmedSent++;
+  framesSinceConfirm++;
+  
+  // Kaçınılan maliyet: gateway'in ACK downlink'i ve gözlenen kayıp oranına
+  // göre beklenen yeniden iletimler (kayıp oranı / başarı oranı adet)
+  uint32_t saved = ackAirtimeMs;
+  if (ackRate > 0 && ackRate < 256) {
+    saved += airtimeMs * (256 - ackRate) / ackRate;
+  }
+  stats.savedAirtimeMs += saved;
+}
+
+void ConfirmPolicy::onConfirmedResult(bool acked) {
+  if (acked) {
+    stats.acked++;
+  } else {
+    stats.missed++;
+  }
+  
+  // Üstel hareketli ortalama, ağırlık 1/4
+  uint16_t sample = acked ? 256 : 0;
+  ackRate = (ackRate * 3 + sample) / 4;
+  stats.ackRatePercent = (uint8_t)((ackRate * 100 + 128) / 256);
+  
+  adapt();
+}
+
+const ConfirmPolicyStats& ConfirmPolicy::getStats() const {
+  return stats;
+}
+
+void ConfirmPolicy::adapt() {
+  if (stats.ackRatePercent >= CONFIRM_RATE_GOOD_PERCENT) {
+    // Bağlantı sağlıklı: ACK'ı daha seyrek iste
+    uint16_t next = stats.ackInterval * 2;
+    stats.ackInterval = next > CONFIRM_INTERVAL_MAX ? CONFIRM_INTERVAL_MAX : next;
+  } else if (stats.ackRatePercent < CONFIRM_RATE_POOR_PERCENT) {
+    // ACK'lar kayboluyor: bağlantıyı daha sık kontrol et
+    uint8_t next = stats.ackInterval / 2;
+    stats.ackInterval = next < CONFIRM_INTERVAL_MIN ? CONFIRM_INTERVAL_MIN : next;
+  }
+}
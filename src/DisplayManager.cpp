@@ -1,7 +1,16 @@
 #include "../Core/Display/DisplayManager.h"
+#include "../Core/Utils/Profiler.h"
 
-DisplayManager::DisplayManager() : currentLogLine(0) {
+DisplayManager::DisplayManager() :
+  displayOn(true),
+  currentLogLine(0),
+  dirty(false),
+  renderedOnce(false),
+  lastRenderTime(0),
+  shadowValid(false) {
   oled = new Adafruit_SSD1306(OLED_WIDTH, OLED_HEIGHT, &Wire, -1);
+  memset(&stats, 0, sizeof(stats));
+  memset(&viewModel, 0, sizeof(viewModel));
   
   // Log satırlarını başlangıçta temizle
   for (int i = 0; i < 4; i++) {
@@ -15,7 +24,7 @@ bool DisplayManager::begin() {
   
   // Ekranı başlat
   if (!oled->begin(SSD1306_SWITCHCAPVCC, OLED_ADDR)) {
-    Serial.println(F("SSD1306 ekranı başlatılamadı"));
+    LOG_ERROR(F("SSD1306 ekranı başlatılamadı"));
     return false;
   }
   
@@ -26,6 +35,10 @@ bool DisplayManager::begin() {
   oled->setCursor(0, 0);
   oled->cp437(true); // Tam karakter seti kullan
   
+  // Ekran belleğinin içeriği bilinmiyor, ilk aktarım tam çerçeve olmalı
+  shadowValid = false;
+  displayOn = true;
+  
   return true;
 }
 
@@ -35,105 +48,116 @@ void DisplayManager::clear() {
 }
 
 void DisplayManager::display() {
-  oled->display();
+  // Tam 1 KB çerçeve yerine yalnızca değişen sayfa/sütun aralıklarını gönder
+  uint32_t start = micros();
+  uint32_t bytesBefore = stats.bytesSent;
+  const uint8_t* buffer = oled->getBuffer();
+  bool anySent = false;
+  
+  Wire.setClock(OLED_I2C_CLOCK);
+  
+  for (uint8_t page = 0; page < OLED_PAGES; page++) {
+    const uint8_t* row = buffer + page * OLED_WIDTH;
+    uint8_t* shadowRow = shadow + page * OLED_WIDTH;
+    
+    // Sayfadaki ilk ve son değişen sütunu bul
+    int16_t first = -1;
+    int16_t last = -1;
+    if (shadowValid) {
+      for (uint8_t col = 0; col < OLED_WIDTH; col++) {
+        if (row[col] != shadowRow[col]) {
+          if (first < 0) first = col;
+          last = col;
+        }
+      }
+    } else {
+      first = 0;
+      last = OLED_WIDTH - 1;
+    }
+    
+    if (first < 0) continue;
+    
+    // Yatay adresleme modunda yazma penceresini değişen bölgeye daralt
+    const uint8_t window[] = {
+      SSD1306_PAGEADDR, page, page,
+      SSD1306_COLUMNADDR, (uint8_t)first, (uint8_t)last
+    };
+    sendCommands(window, sizeof(window));
+    sendData(row + first, last - first + 1);
+    
+    memcpy(shadowRow + first, row + first, last - first + 1);
+    anySent = true;
+  }
+  
+  shadowValid = true;
+  
+  // Tam çerçeve: pencere komutları (7 byte) + 1024 veri + her 31 veri byte'ı için kontrol byte'ı
+  const uint32_t fullFrameBytes = 7 + OLED_WIDTH * OLED_PAGES +
+                                  (OLED_WIDTH * OLED_PAGES + OLED_I2C_CHUNK - 1) / OLED_I2C_CHUNK;
+  uint32_t sent = stats.bytesSent - bytesBefore;
+  
+  stats.frames++;
+  if (!anySent) {
+    stats.skippedFrames++;
+  }
+  if (sent < fullFrameBytes) {
+    stats.bytesSaved += fullFrameBytes - sent;
+  }
+  stats.lastFrameUs = micros() - start;
+  if (stats.lastFrameUs > stats.maxFrameUs) {
+    stats.maxFrameUs = stats.lastFrameUs;
+  }
+}
+
+void DisplayManager::sendCommands(const uint8_t* commands, uint8_t count) {
+  // Kontrol byte'ı 0x00: ardından gelen byte'lar komut
+  Wire.beginTransmission(OLED_ADDR);
+  Wire.write((uint8_t)0x00);
+  Wire.write(commands, count);
+  Wire.endTransmission();
+  stats.bytesSent += 1 + count;
+}
+
+void DisplayManager::sendData(const uint8_t* data, uint16_t count) {
+  // Kontrol byte'ı 0x40: ardından gelen byte'lar GDDRAM verisi
+  while (count > 0) {
+    uint8_t chunk = count > OLED_I2C_CHUNK ? OLED_I2C_CHUNK : count;
+    Wire.beginTransmission(OLED_ADDR);
+    Wire.write((uint8_t)0x40);
+    Wire.write(data, chunk);
+    Wire.endTransmission();
+    stats.bytesSent += 1 + chunk;
+    data += chunk;
+    count -= chunk;
+  }
+}
+
+const DisplayStats& DisplayManager::getStats() const {
+  return stats;
 }
 
 void DisplayManager::showStartupScreen() {
-  clear();
-  oled->setTextSize(1);
-  oled->setCursor(0, 0);
-  oled->println(F("KEPMARK LoRaWAN"));
-  oled->println(F("Baslatiliyor..."));
-  oled->println();
-  oled->print(F("DevEUI: "));
-  
-  // DevEUI'yi ekranda göster
-  char devEuiStr[20] = {0};
-  for (int i = 0; i < 8; i++) {
-    snprintf(devEuiStr + strlen(devEuiStr), sizeof(devEuiStr) - strlen(devEuiStr),
-             "%02X", DEVEUI[7-i]); // MSB formatında
-  }
-  oled->println(devEuiStr);
-  display();
+  setView(VIEW_STARTUP, nullptr, false);
 }
 
 void DisplayManager::showConnectionStatus(bool isConnected) {
-  clear();
-  oled->setTextSize(1);
-  oled->setCursor(0, 0);
-  oled->println(F("LoRaWAN Baglantisi:"));
-  oled->println();
-  
-  if (isConnected) {
-    oled->println(F("* BAGLI *"));
-  } else {
-    oled->println(F("Baglaniliyor..."));
-  }
-  
-  // Son log satırlarını göster
-  oled->println();
-  oled->println(F("Son Olaylar:"));
-  
-  for (int i = 0; i < 4; i++) {
-    int idx = (currentLogLine + i) % 4;
-    if (strlen(logLines[idx]) > 0) {
-      oled->println(logLines[idx]);
-    }
-  }
-  
-  display();
+  setView(VIEW_CONNECTION, nullptr, isConnected);
 }
 
 void DisplayManager::showLoRaStatus(const char* status, bool connected) {
-  oled->clearDisplay();
-  oled->setCursor(0, 0);
-  oled->println(F("LoRaWAN Durumu:"));
-  oled->println();
-  oled->println(status);
-  oled->println();
-  
-  if (connected) {
-    oled->println(F("Aga baglandi"));
-  } else {
-    oled->println(F("Aga baglanamadi"));
-  }
-  
-  oled->display();
+  setView(VIEW_LORA_STATUS, status, connected);
 }
 
 void DisplayManager::showSendStatus(const char* message, bool success) {
-  oled->clearDisplay();
-  oled->setCursor(0, 0);
-  oled->println(F("Veri Gonderimi:"));
-  oled->println();
-  oled->println(message);
-  oled->println();
-  
-  if (success) {
-    oled->println(F("BASARILI"));
-  } else {
-    oled->println(F("BASARISIZ"));
-  }
-  
-  oled->display();
+  setView(VIEW_SEND_STATUS, message, success);
 }
 
 void DisplayManager::showLastValues(const char* sensorData) {
-  oled->clearDisplay();
-  oled->setCursor(0, 0);
-  oled->println(F("Son Olcumler:"));
-  oled->println();
-  oled->println(sensorData);
-  oled->display();
+  setView(VIEW_LAST_VALUES, sensorData, false);
 }
 
 void DisplayManager::showDebugInfo(const char* info) {
-  oled->clearDisplay();
-  oled->setCursor(0, 0);
-  oled->println(F("Debug Bilgisi:"));
-  oled->println();
-  oled->println(info);
-  oled->display();
+  setView(VIEW_DEBUG, info, false);
 }
 
 void DisplayManager::addLogLine(const char* logLine) {
@@ -143,4 +167,159 @@ void DisplayManager::addLogLine(const char* logLine) {
   
   // Log satırı indeksini güncelle
   currentLogLine = (currentLogLine + 1) % 4;
-} 
\ No newline at end of file
+  
+  // Olay satırları yalnızca bağlantı ekranında görünür
+  if (viewModel.view == VIEW_CONNECTION) {
+    markDirty();
+  }
+}
+
+void DisplayManager::service(bool radioBusy) {
+  if (!dirty || !displayOn) {
+    return;
+  }
+  
+  // Radyo zamanlamasına yakınken ve kare hızı sınırı dolmadan çizme;
+  // bu arada gelen güncellemeler tek bir karede birleşir
+  if (radioBusy) {
+    return;
+  }
+  if (renderedOnce && (Utils::getTimestamp() - lastRenderTime) < (1000 / DISPLAY_MAX_FPS)) {
+    return;
+  }
+  
+  renderNow();
+}
+
+void DisplayManager::renderNow() {
+  PROFILE_SCOPE(PROF_RENDER);
+  renderView();
+  display();
+  
+  dirty = false;
+  renderedOnce = true;
+  lastRenderTime = Utils::getTimestamp();
+  stats.renders++;
+}
+
+void DisplayManager::setView(DisplayView view, const char* text, bool flag) {
+  viewModel.view = view;
+  viewModel.flag = flag;
+  if (text) {
+    strncpy(viewModel.text, text, sizeof(viewModel.text) - 1);
+    viewModel.text[sizeof(viewModel.text) - 1] = '\0';
+  } else {
+    viewModel.text[0] = '\0';
+  }
+  markDirty();
+}
+
+void DisplayManager::markDirty() {
+  // Henüz çizilmemiş bir güncellemenin üzerine yazılıyorsa kare tasarruf edildi
+  if (dirty) {
+    stats.coalescedUpdates++;
+  }
+  dirty = true;
+}
+
+void DisplayManager::renderView() {
+  clear();
+  oled->setTextSize(1);
+  
+  switch (viewModel.view) {
+    case VIEW_STARTUP: {
+      oled->println(F("KEPMARK LoRaWAN"));
+      oled->println(F("Baslatiliyor..."));
+      oled->println();
+      oled->print(F("DevEUI: "));
+      
+      // DevEUI'yi ekranda göster
+      char devEuiStr[20] = {0};
+      for (int i = 0; i < 8; i++) {
+        snprintf(devEuiStr + strlen(devEuiStr), sizeof(devEuiStr) - strlen(devEuiStr),
+                 "%02X", DEVEUI[7-i]); // MSB formatında
+      }
+      oled->println(devEuiStr);
+      break;
+    }
+    
+    case VIEW_CONNECTION:
+      oled->println(F("LoRaWAN Baglantisi:"));
+      oled->println();
+      
+      if (viewModel.flag) {
+        oled->println(F("* BAGLI *"));
+      } else {
+        oled->println(F("Baglaniliyor..."));
+      }
+      
+      // Son log satırlarını göster
+      oled->println();
+      oled->println(F("Son Olaylar:"));
+      
+      for (int i = 0; i < 4; i++) {
+        int idx = (currentLogLine + i) % 4;
+        if (strlen(logLines[idx]) > 0) {
+          oled->println(logLines[idx]);
+        }
+      }
+      break;
+    
+    case VIEW_LORA_STATUS:
+      oled->println(F("LoRaWAN Durumu:"));
+      oled->println();
+      oled->println(viewModel.text);
+      oled->println();
+      
+      if (viewModel.flag) {
+        oled->println(F("Aga baglandi"));
+      } else {
+        oled->println(F("Aga baglanamadi"));
+      }
+      break;
+    
+    case VIEW_SEND_STATUS:
+      oled->println(F("Veri Gonderimi:"));
+      oled->println();
+      oled->println(viewModel.text);
+      oled->println();
+      
+      if (viewModel.flag) {
+        oled->println(F("BASARILI"));
+      } else {
+        oled->println(F("BASARISIZ"));
+      }
+      break;
+    
+    case VIEW_LAST_VALUES:
+      oled->println(F("Son Olcumler:"));
+      oled->println();
+      oled->println(viewModel.text);
+      break;
+    
+    case VIEW_DEBUG:
+      oled->println(F("Debug Bilgisi:"));
+      oled->println();
+      oled->println(viewModel.text);
+      break;
+  }
+}
+
+void DisplayManager::turnOn() {
+  if (!displayOn) {
+    oled->ssd1306_command(SSD1306_DISPLAYON);
+    displayOn = true;
+    markDirty(); // Kapalıyken biriken değişiklikleri çiz
+  }
+}
+
+void DisplayManager::turnOff() {
+  if (displayOn) {
+    oled->ssd1306_command(SSD1306_DISPLAYOFF);
+    displayOn = false;
+  }
+}
+
+bool DisplayManager::isOn() const {
+  return displayOn;
+}
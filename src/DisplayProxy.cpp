@@ -0,0 +1,66 @@
+#include "../Core/Display/DisplayProxy.h"
+
+void DisplayProxy::addLogLine(const char* logLine) {
+  post(DISPLAY_CMD_LOG_LINE, logLine, false);
+}
+
+void DisplayProxy::showDebugInfo(const char* info) {
+  post(DISPLAY_CMD_DEBUG_INFO, info, false);
+}
+
+void DisplayProxy::showSendStatus(const char* message, bool success) {
+  post(DISPLAY_CMD_SEND_STATUS, message, success);
+}
+
+void DisplayProxy::showConnectionStatus(bool isConnected) {
+  post(DISPLAY_CMD_CONNECTION, nullptr, isConnected);
+}
+
+void DisplayProxy::showLoRaStatus(const char* status, bool connected) {
+  post(DISPLAY_CMD_LORA_STATUS, status, connected);
+}
+
+void DisplayProxy::post(DisplayCommandType type, const char* text, bool flag) {
+  DisplayCommand command;
+  command.type = type;
+  command.flag = flag;
+  if (text) {
+    strncpy(command.text, text, sizeof(command.text) - 1);
+    command.text[sizeof(command.text) - 1] = '\0';
+  } else {
+    command.text[0] = '\0';
+  }
+  commands.push(command);
+}
+
+uint16_t DisplayProxy::applyTo(DisplayManager& display) {
+  uint16_t applied = 0;
+  DisplayCommand command;
+
+  while (commands.pop(command)) {
+    switch (command.type) {
+      case DISPLAY_CMD_LOG_LINE:
+        display.addLogLine(command.text);
+        break;
+      case DISPLAY_CMD_DEBUG_INFO:
+        display.showDebugInfo(command.text);
+        break;
+      case DISPLAY_CMD_SEND_STATUS:
+        display.showSendStatus(command.text, command.flag);
+        break;
+      case DISPLAY_CMD_CONNECTION:
+        display.showConnectionStatus(command.flag);
+        break;
+      case DISPLAY_CMD_LORA_STATUS:
+        display.showLoRaStatus(command.text, command.flag);
+        break;
+    }
+    applied++;
+  }
+
+  return applied;
+}
+
+uint32_t DisplayProxy::getDropped() const {
+  return commands.getDropped();
+}
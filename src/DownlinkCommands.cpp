@@ -0,0 +1,116 @@
+#include "../Features/Messaging/DownlinkCommands.h"
+#include "../Features/Messaging/MessageService.h"
+#include "../Core/Lora/LoraManager.h"
+#include "../Core/Lora/RegionPlan.h"
+#include "../Core/Utils/LogRing.h"
+
+// Durum yanıtı: [0x03][çalışma süresi s u32][aralık s u16][DR][güç dBm][saat hatası ppm u16]
+// 11 byte; her bölgenin en düşük veri hızına sığar.
+#define DOWNLINK_STATUS_SIZE 11
+
+DownlinkCommands::DownlinkCommands() :
+  loraManager(nullptr),
+  messageService(nullptr),
+  sendIntervalMs(APP_SEND_INTERVAL_MS) {
+  memset(&stats, 0, sizeof(stats));
+}
+
+bool DownlinkCommands::begin(DownlinkDispatcher& dispatcher, LoraManager* lora, MessageService* messages) {
+  loraManager = lora;
+  messageService = messages;
+  return dispatcher.on(DOWNLINK_COMMAND_PORT, onCommand, this);
+}
+
+uint32_t DownlinkCommands::getSendIntervalMs() const {
+  return sendIntervalMs;
+}
+
+const DownlinkCommandStats& DownlinkCommands::getStats() const {
+  return stats;
+}
+
+void DownlinkCommands::execute(PayloadView payload) {
+  bool statusRequested = false;
+
+  while (!payload.atEnd()) {
+    uint8_t opcode = payload.readU8();
+    uint8_t before = payload.remaining();
+    bool ok;
+
+    switch (opcode) {
+      case DOWNLINK_OP_SET_INTERVAL: ok = setInterval(payload); break;
+      case DOWNLINK_OP_SET_DATARATE: ok = setDatarate(payload); break;
+      case DOWNLINK_OP_STATUS:
+        statusRequested = true;
+        ok = true;
+        break;
+      default:
+        // Argüman boyu bilinmediği için çerçevenin kalanı atlanır;
+        // önceki komutlar (durum isteği dahil) geçerli kalır
+        stats.unknown++;
+        LOG_RECORD(LOG_LEVEL_ERROR, LOG_DOWNLINK_COMMAND, opcode, false, payload.remaining());
+        payload.readView(payload.remaining());
+        continue;
+    }
+
+    if (ok) {
+      stats.executed++;
+    } else {
+      stats.rejected++;
+    }
+    // Eksik argümanda görünüm sona taşınır ve döngü biter
+    LOG_RECORD(LOG_LEVEL_INFO, LOG_DOWNLINK_COMMAND, opcode, ok, before - payload.remaining());
+  }
+
+  // Çerçeve tamamen okundu; gönderim artık LMIC.frame'i yeniden yazabilir
+  if (statusRequested) {
+    sendStatus();
+  }
+}
+
+bool DownlinkCommands::setInterval(PayloadView& payload) {
+  uint16_t seconds = payload.readU16();
+  if (payload.hasError() || seconds < DOWNLINK_MIN_INTERVAL_S) {
+    return false;
+  }
+  sendIntervalMs = (uint32_t)seconds * 1000;
+  return true;
+}
+
+bool DownlinkCommands::setDatarate(PayloadView& payload) {
+  uint8_t datarate = payload.readU8();
+  if (payload.hasError() || Region::maxPayload(datarate) == 0 || !loraManager) {
+    return false;
+  }
+  loraManager->getRadioProfile().set(RADIO_PARAM_DATARATE, datarate);
+  return true;
+}
+
+bool DownlinkCommands::sendStatus() {
+  if (!messageService || !loraManager) {
+    return false;
+  }
+
+  uint32_t uptime = Utils::getTimestamp() / 1000;
+  uint16_t interval = sendIntervalMs / 1000;
+  uint32_t ppm = loraManager->getRxCalibration().getStats().clockErrorPpm;
+  if (ppm > 0xFFFF) {
+    ppm = 0xFFFF;
+  }
+
+  uint8_t status[DOWNLINK_STATUS_SIZE] = {
+    DOWNLINK_OP_STATUS,
+    (uint8_t)(uptime >> 24), (uint8_t)(uptime >> 16), (uint8_t)(uptime >> 8), (uint8_t)uptime,
+    (uint8_t)(interval >> 8), (uint8_t)interval,
+    (uint8_t)LMIC.datarate,
+    (uint8_t)LMIC.adrTxPow,
+    (uint8_t)(ppm >> 8), (uint8_t)ppm
+  };
+
+  return messageService->sendData(status, sizeof(status), DOWNLINK_STATUS_PORT, PRIORITY_HIGH);
+}
+
+void DownlinkCommands::onCommand(void* context, uint8_t port, PayloadView payload) {
+  (void)port;
+  static_cast<DownlinkCommands*>(context)->execute(payload);
+}
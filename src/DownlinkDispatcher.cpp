@@ -0,0 +1,74 @@
+#include "../Features/Messaging/DownlinkDispatcher.h"
+#include <string.h>
+#include "../Core/Utils/LogRing.h"
+
+DownlinkDispatcher::DownlinkDispatcher() {
+  memset(routes, 0, sizeof(routes));
+  memset(&stats, 0, sizeof(stats));
+}
+
+bool DownlinkDispatcher::on(uint8_t port, DownlinkHandler handler, void* context) {
+  if (port < DOWNLINK_PORT_MIN || port > DOWNLINK_PORT_MAX || !handler) {
+    return false;
+  }
+
+  Route* route = find(port);
+  if (!route) {
+    route = find(0);
+  }
+  if (!route) {
+    return false;
+  }
+
+  route->port = port;
+  route->handler = handler;
+  route->context = context;
+  return true;
+}
+
+bool DownlinkDispatcher::off(uint8_t port) {
+  Route* route = port ? find(port) : nullptr;
+  if (!route) {
+    return false;
+  }
+  route->port = 0;
+  route->handler = nullptr;
+  route->context = nullptr;
+  return true;
+}
+
+bool DownlinkDispatcher::dispatch(uint8_t port, PayloadView payload) {
+  // Port 0 yalnızca MAC komutu taşır; LMIC işler
+  if (port < DOWNLINK_PORT_MIN) {
+    return false;
+  }
+
+  Route* route = find(port);
+  if (!route) {
+    stats.unrouted++;
+    LOG_RECORD(LOG_LEVEL_INFO, LOG_DOWNLINK_UNROUTED, port, payload.size());
+    return false;
+  }
+
+  stats.dispatched++;
+  stats.bytes += payload.size();
+  route->handler(route->context, port, payload);
+  return true;
+}
+
+const DownlinkDispatchStats& DownlinkDispatcher::getStats() const {
+  return stats;
+}
+
+void DownlinkDispatcher::onDownlink(void* context, uint8_t port, PayloadView payload) {
+  static_cast<DownlinkDispatcher*>(context)->dispatch(port, payload);
+}
+
+DownlinkDispatcher::Route* DownlinkDispatcher::find(uint8_t port) {
+  for (uint8_t i = 0; i < DOWNLINK_ROUTES; i++) {
+    if (routes[i].port == port) {
+      return &routes[i];
+    }
+  }
+  return nullptr;
+}
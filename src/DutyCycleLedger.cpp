@@ -0,0 +1,100 @@
+#include "../Core/Lora/DutyCycleLedger.h"
+
+DutyCycleLedger::DutyCycleLedger() {
+  memset(availableAt, 0, sizeof(availableAt));
+  memset(airtimeTotal, 0, sizeof(airtimeTotal));
+  memset(used, 0, sizeof(used));
+}
+
+void DutyCycleLedger::recordTransmission(uint8_t band, uint32_t airtimeMs) {
+  if (band >= DUTY_CYCLE_BANDS) return;
+  
+  availableAt[band] = Utils::getTimestamp() + airtimeMs * dutyDivider(band);
+  airtimeTotal[band] += airtimeMs;
+  used[band] = true;
+}
+
+void DutyCycleLedger::recordCurrentTransmission() {
+  // EV_TXSTART anında LMIC.dataLen gönderilen PHY çerçeve boyutunu tutar
+  rps_t rps = LMIC.rps;
+  if (getSf(rps) == FSK) return;
+  
+  LoraTxParams p;
+  p.spreadingFactor = getSf(rps) - SF7 + 7;
+  p.bandwidthHz = 125000UL << getBw(rps);
+  p.codingRate = getCr(rps) - CR_4_5 + 1;
+  p.preambleSymbols = 8;
+  p.explicitHeader = getIh(rps) == 0;
+  p.crc = getNocrc(rps) == 0;
+  
+  recordTransmission(bandOfChannel(LMIC.txChnl), Airtime::timeOnAirMs(p, LMIC.dataLen));
+}
+
+void DutyCycleLedger::shiftClock(uint32_t elapsedMs) {
+  // Karşılaştırmalar işaretli farkla yapıldığından geçmişte kalan zamanlar
+  // kaydırmadan sonra da geçmişte kalır
+  for (uint8_t band = 0; band < DUTY_CYCLE_BANDS; band++) {
+    availableAt[band] -= elapsedMs;
+  }
+}
+
+uint32_t DutyCycleLedger::bandAvailableAt(uint8_t band) const {
+  return band < DUTY_CYCLE_BANDS ? availableAt[band] : 0;
+}
+
+uint32_t DutyCycleLedger::nextSendTime() const {
+  uint32_t now = Utils::getTimestamp();
+  uint32_t earliest = 0;
+  bool found = false;
+  
+  // LMIC yalnızca etkin kanalların bantlarından birini seçer
+  for (uint8_t ch = 0; ch < MAX_CHANNELS; ch++) {
+#if CFG_LMIC_EU_like
+    if (LMIC.channelFreq[ch] == 0 || !(LMIC.channelMap & (1 << ch))) continue;
+#else
+    // US benzeri bölgelerde kanal frekansı sabittir; maske 16 bitlik sözcüklerdedir
+    if (!(LMIC.channelMap[ch >> 4] & (1 << (ch & 15)))) continue;
+#endif
+    
+    uint8_t band = bandOfChannel(ch);
+    uint32_t at = used[band] && (int32_t)(availableAt[band] - now) > 0 ? availableAt[band] : now;
+    if (!found || (int32_t)(at - earliest) < 0) {
+      earliest = at;
+      found = true;
+    }
+  }
+  
+  return found ? earliest : now;
+}
+
+bool DutyCycleLedger::canSendNow() const {
+  return (int32_t)(nextSendTime() - Utils::getTimestamp()) <= 0;
+}
+
+uint32_t DutyCycleLedger::totalAirtimeMs(uint8_t band) const {
+  return band < DUTY_CYCLE_BANDS ? airtimeTotal[band] : 0;
+}
+
+uint32_t DutyCycleLedger::uplinkAirtimeMs(dr_t datarate, uint8_t appPayloadBytes) {
+  rps_t rps = updr2rps(datarate);
+  if (getSf(rps) == FSK) {
+    // 50 kbps FSK: önsöz(5) + senkron(3) + uzunluk(1) + yük + CRC(2) byte, 160 µs/byte
+    return ((uint32_t)(appPayloadBytes + LORAWAN_FRAME_OVERHEAD + 11) * 160 + 999) / 1000;
+  }
+  return Airtime::uplinkMs(getSf(rps) - SF7 + 7, appPayloadBytes, 125000UL << getBw(rps));
+}
+
+uint8_t DutyCycleLedger::bandOfChannel(uint8_t channel) {
+#if defined(CFG_eu868)
+  // EU868'de LMIC bant indeksini frekansın düşük bitlerinde saklar
+  return LMIC.channelFreq[channel] & 0x3;
+#else
+  // Diğer bölgelerin planında tek bant vardır
+  (void)channel;
+  return 0;
+#endif
+}
+
+uint16_t DutyCycleLedger::dutyDivider(uint8_t band) {
+  return Region::dutyDivider(band);
+}
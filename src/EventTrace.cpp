@@ -0,0 +1,58 @@
+#include "../Core/Lora/EventTrace.h"
+
+EventTrace::EventTrace() {
+  clear();
+}
+
+void EventTrace::record(ev_t ev) {
+  TraceRecord& r = records[next];
+  r.timestampMs = Utils::getTimestamp();
+  r.osTime = os_getTime();
+  r.rxtime = LMIC.rxtime;
+  r.txend = LMIC.txend;
+  r.freq = LMIC.freq;
+  r.opmode = LMIC.opmode;
+  r.ev = (uint8_t)ev;
+  r.datarate = LMIC.datarate;
+  r.txrxFlags = LMIC.txrxFlags;
+  r.dataLen = LMIC.dataLen;
+  r.rxDelay = LMIC.rxDelay;
+  r.rxsyms = LMIC.rxsyms;
+
+  next = (next + 1) % EVENT_TRACE_CAPACITY;
+  if (size < EVENT_TRACE_CAPACITY) {
+    size++;
+  } else {
+    overwritten++;
+  }
+}
+
+void EventTrace::dump(Print& out) const {
+  TraceDumpHeader header;
+  header.magic = TRACE_DUMP_MAGIC;
+  header.version = TRACE_DUMP_VERSION;
+  header.recordSize = sizeof(TraceRecord);
+  header.count = size;
+  header.osTicksPerSec = OSTICKS_PER_SEC;
+  header.overwritten = overwritten;
+  out.write((const uint8_t*)&header, sizeof(header));
+
+  // Halka tamponu eskiden yeniye düz sırayla yaz (en fazla iki parça)
+  uint16_t first = (next + EVENT_TRACE_CAPACITY - size) % EVENT_TRACE_CAPACITY;
+  uint16_t tailCount = size < EVENT_TRACE_CAPACITY - first ? size : EVENT_TRACE_CAPACITY - first;
+  out.write((const uint8_t*)&records[first], tailCount * sizeof(TraceRecord));
+  if (tailCount < size) {
+    out.write((const uint8_t*)&records[0], (size - tailCount) * sizeof(TraceRecord));
+  }
+}
+
+void EventTrace::clear() {
+  memset(records, 0, sizeof(records));
+  next = 0;
+  size = 0;
+  overwritten = 0;
+}
+
+uint16_t EventTrace::count() const {
+  return size;
+}
@@ -0,0 +1,83 @@
+#include "../Core/Utils/LogRing.h"
+
+SpscQueue<LogRecord, LOG_RING_CAPACITY> LogRing::ring;
+
+bool LogRing::push(uint8_t id, int32_t a0, int32_t a1, int32_t a2, int32_t a3) {
+  // Biçim tablosunda adı olan argüman sayısı kadar yaz
+  uint8_t argc = id < LOG_EVENT_COUNT ? kLogArgCounts[id] : 0;
+  return pushArgs(id, argc, a0, a1, a2, a3);
+}
+
+bool LogRing::pushArgs(uint8_t id, uint8_t argc, int32_t a0, int32_t a1, int32_t a2, int32_t a3) {
+  LogRecord r;
+  r.timestamp = Utils::getTimestamp();
+  r.id = id;
+  r.argc = argc;
+  r.reserved = 0;
+  r.args[0] = a0;
+  r.args[1] = a1;
+  r.args[2] = a2;
+  r.args[3] = a3;
+  
+  return ring.push(r);
+}
+
+void LogRing::pushBytes(uint8_t id, const uint8_t* data, uint8_t length) {
+  while (length > 0) {
+    uint8_t chunk = length > sizeof(LogRecord::bytes) ? sizeof(LogRecord::bytes) : length;
+    int32_t words[LOG_RECORD_ARGS] = {0};
+    memcpy(words, data, chunk);
+    
+    if (!pushArgs(id, chunk, words[0], words[1], words[2], words[3])) {
+      return;
+    }
+    data += chunk;
+    length -= chunk;
+  }
+}
+
+uint16_t LogRing::flush(Print& out, uint16_t maxRecords) {
+  uint16_t written = 0;
+  
+  while (written < maxRecords) {
+    const LogRecord* next = ring.front();
+    if (!next) {
+      break;
+    }
+    
+    const LogRecord& r = *next;
+    
+#if LOG_OUTPUT_BINARY
+    // Host çözücü için: eşitleme byte'ı + ham kayıt
+    if (out.availableForWrite() < (int)sizeof(LogRecord) + 1) {
+      break;
+    }
+    out.write((uint8_t)LOG_SYNC_BYTE);
+    out.write((const uint8_t*)&r, sizeof(LogRecord));
+#else
+    char line[128];
+    size_t length = formatLogRecord(r, line, sizeof(line) - 2);
+    line[length++] = '\r';
+    line[length++] = '\n';
+    
+    // UART TX tamponunda yer yoksa bekleme; kalan kayıtlar sonraki flush'a kalır
+    if (out.availableForWrite() < (int)length) {
+      break;
+    }
+    out.write((const uint8_t*)line, length);
+#endif
+    
+    ring.pop();
+    written++;
+  }
+  
+  return written;
+}
+
+uint16_t LogRing::pending() {
+  return ring.size();
+}
+
+uint32_t LogRing::getDropped() {
+  return ring.getDropped();
+}
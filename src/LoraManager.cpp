@@ -1,9 +1,28 @@
 #include "../Core/Lora/LoraManager.h"
-#include "../Core/Display/DisplayManager.h"
+#include "../Core/Utils/LogRing.h"
+#include "../Core/Utils/Profiler.h"
+#include "../Core/Lora/LowPower.h"
 
-// Static pointer to LoraManager instance for callbacks
-static LoraManager* loraManagerInstance = nullptr;
-static DisplayManager* displayInstance = nullptr;
+// Derin uykuda RTC belleğinde korunan radyo durumu. RTC_DATA_ATTR değişkenleri
+// her açılışta yapıcıyla yeniden başlatılmamalı; bu yüzden yalnızca düz yapılar
+// ve ham byte tutulur
+struct LoraSleepState {
+  uint32_t magic;
+  lmic_t lmic;
+  uint8_t dutyCycle[sizeof(DutyCycleLedger)];
+  uint8_t rxCalibration[sizeof(RxCalibration)];
+  LoraSessionCounters counters;
+  LoraSession session;
+};
+
+#if defined(ESP32)
+RTC_DATA_ATTR static LoraSleepState sleepState;
+#endif
+
+// Uzun süreleri taşmadan LMIC tick'ine çevir
+static ostime_t msToTicks(uint32_t ms) {
+  return (ostime_t)((int64_t)ms * OSTICKS_PER_SEC / 1000);
+}
 
 // LMIC için pin konfigürasyonu - global değişken olarak tanımlanması gerekiyor
 const lmic_pinmap lmic_pins = {
@@ -13,23 +32,6 @@ const lmic_pinmap lmic_pins = {
   .dio = {LORA_IRQ, LORA_IRQ, LORA_IRQ}, // TTGO'da IRQ multiplexed, tüm DIO pinleri aynı
 };
 
-// Protokol ve bant adını almak için
-const char* LMIC_getNetworkName() {
-  #if defined(CFG_eu868)
-  return "EU868";
-  #elif defined(CFG_us915)
-  return "US915";
-  #elif defined(CFG_as923)
-  return "AS923";
-  #elif defined(CFG_kr920)
-  return "KR920";
-  #elif defined(CFG_in866)
-  return "IN866";
-  #else
-  return "UNKNOWN";
-  #endif
-}
-
 // Callback fonksiyonları - LMIC kütüphanesi için gerekli
 void os_getArtEui(u1_t* buf) {
   memcpy_P(buf, APPEUI, 8);
@@ -46,9 +48,25 @@ void os_getDevKey(u1_t* buf) {
 LoraManager::LoraManager() : 
   joined(false), 
   lastJoinAttempt(0),
-  eventCallback(nullptr),
-  txCompleteCallback(nullptr) {
-  loraManagerInstance = this;
+  txInFlight(false),
+  txEndAtStart(0),
+  joinState(JOIN_IDLE),
+  joinStateSince(0),
+  joinBackoffMs(0),
+  firstJoinTime(0),
+  joinAttempts(0),
+  sessionDirty(false),
+  countersDirty(false),
+  rejoinRequested(false),
+  displayManager(nullptr),
+  eventsDispatched(0),
+  eventQueueMaxDepth(0),
+  downlinkHandler(nullptr),
+  downlinkContext(nullptr),
+  txFrameSeq(0),
+  staleDownlinks(0) {
+  memset(&savedSession, 0, sizeof(savedSession));
+  memset(&sessionCounters, 0, sizeof(sessionCounters));
 }
 
 void LoraManager::setup() {
@@ -58,202 +76,107 @@ void LoraManager::setup() {
   // LMIC başlatma - pin yapılandırması ile
   os_init_ex(&lmic_pins);
   
+  // Olaylar global bir işaretçi yerine kullanıcı verisiyle bu nesneye gelir;
+  // LMIC_reset kayıtlı geri çağırmayı korur
+  LMIC_registerEventCb(onLmicEvent, this);
+  
   // Debug bilgilerini yazdır
-  Serial.println(F("LMIC kütüphanesi başlatıldı"));
-  Serial.print(F("Debug seviyesi: "));
-  Serial.println(LORA_DEBUG_LEVEL);
+  LOG_INFO(F("LMIC kütüphanesi başlatıldı, log seviyesi: "), LORA_DEBUG_LEVEL);
   
-  if (displayInstance) {
-    displayInstance->addLogLine("LMIC kutuphanesi");
-    displayInstance->addLogLine("basladi");
+  if (displayManager) {
+    displayProxy.addLogLine("LMIC kutuphanesi");
+    displayProxy.addLogLine("basladi");
   }
   
-  // Tüm yapıyı sıfırla
-  LMIC_reset();
-  
-  // ESP32 saat hatası düzeltmesi
-  LMIC_setClockError(MAX_CLOCK_ERROR * CLOCK_ERROR_PERCENTAGE / 100);
-  Serial.print(F("Saat hatası düzeltmesi: "));
-  Serial.print(CLOCK_ERROR_PERCENTAGE);
-  Serial.println(F("%"));
-  
-  // RX pencere zamanlamasını ayarla
-  LMIC.rxDelay = 5;  // RX1 penceresi için 5 saniye gecikme (ChirpStack'in yapılandırması ile eşleşmeli)
-  LMIC.rx1DrOffset = 0;  // SF7 ile alma için dr offset = 0 
-  
-  // Alıcı konfigürasyonunu agresif şekilde iyileştir
-  LMIC.rxsyms = 50; // Uzun sembol bekleme süresi
-  
-  // Avrupa (EU868) frekans bandını ayarla
-  LMIC_setupChannel(0, 868100000, DR_RANGE_MAP(DR_SF12, DR_SF7),  BAND_CENTI);
-  LMIC_setupChannel(1, 868300000, DR_RANGE_MAP(DR_SF12, DR_SF7B), BAND_CENTI);
-  LMIC_setupChannel(2, 868500000, DR_RANGE_MAP(DR_SF12, DR_SF7),  BAND_CENTI);
-  LMIC_setupChannel(3, 867100000, DR_RANGE_MAP(DR_SF12, DR_SF7),  BAND_CENTI);
-  LMIC_setupChannel(4, 867300000, DR_RANGE_MAP(DR_SF12, DR_SF7),  BAND_CENTI);
-  LMIC_setupChannel(5, 867500000, DR_RANGE_MAP(DR_SF12, DR_SF7),  BAND_CENTI);
-  LMIC_setupChannel(6, 867700000, DR_RANGE_MAP(DR_SF12, DR_SF7),  BAND_CENTI);
-  LMIC_setupChannel(7, 867900000, DR_RANGE_MAP(DR_SF12, DR_SF7),  BAND_CENTI);
-  LMIC_setupChannel(8, 868800000, DR_RANGE_MAP(DR_FSK,  DR_FSK),  BAND_MILLI);
-  
-  // JOIN için SF9 kullan - ChirpStack SF7 ile yanıt veriyor
-  LMIC_setDrTxpow(DR_SF9, 14); // Önceki: SF7
-  
-  // Otomatik kanal seçimini devre dışı bırak
-  LMIC_setLinkCheckMode(0);
-  
-  // Adr adaptif veri hızını devre dışı bırak
-  LMIC_setAdrMode(0);
-  
-  // RX2 için SF9 kullan
-  //LMIC.dn2Dr = DR_SF9;
-  // RX2 için SF12 kullan (en güvenilir)
-  LMIC.dn2Dr = DR_SF9;
-  
-  Serial.println(F("-----------------------------------"));
-  Serial.print(F("Bant ayarı: "));
-  Serial.println(LMIC_getNetworkName());
+  // Tüm yapıyı sıfırla; kanal planı, RX pencereleri ve veri hızı tek noktadan uygulanır
+  resetRadio();
   
-  // JOIN için SF9 kullan - ChirpStack SF7 ile yanıt veriyor
-  LMIC_setDrTxpow(DR_SF9, 14);
+  LOG_DEBUG(F("Saat hatası düzeltmesi: "), CLOCK_ERROR_PERCENTAGE, F("% (kalibrasyona kadar)"));
+  LOG_INFO(F("Bant ayarı: "), Region::current().name);
   
-  // RX1 için DR offset ayarla - ChirpStack SF7 ile yanıt verdiğinde alabilmek için
-  LMIC.rx1DrOffset = 0; // SF7 için dr offset = 0
-  
-  // RX2 için standart SF9 kullan
-  LMIC.dn2Dr = DR_SF9;
-  
-  // Ağa katılma isteği gönder
-  LMIC_startJoining();
-  
-  Serial.println(F("LoRa Manager başlatıldı, OTAA ile ağa katılma başlatılıyor"));
-  Serial.print(F("DEVEUI: "));
-  for (int i = 0; i < 8; i++) {
-    if (DEVEUI[i] < 0x10) Serial.print('0');
-    Serial.print(DEVEUI[i], HEX);
+  // Derin uykudan dönüşte LMIC durumu olduğu gibi geri yüklenir. Kayıtlı oturum
+  // varsa join atlanır; elektrik kesintisinden sonra tüm cihazların aynı anda
+  // join denemesi ve ağ geçidi downlink yükü önlenir
+  if (resumeFromSleep()) {
+    LOG_INFO(F("LoRa Manager başlatıldı, derin uykudan devam ediliyor"));
+  } else if (restoreSession()) {
+    LOG_INFO(F("LoRa Manager başlatıldı, kayıtlı oturum yüklendi (join atlandı)"));
+  } else {
+    // Ağa katılma isteği gönder
+    startJoin();
+    firstJoinTime = Utils::getTimestamp();
+    joinAttempts = 1;
+    enterJoinState(JOIN_IN_PROGRESS);
+    
+    LOG_INFO(F("LoRa Manager başlatıldı, OTAA ile ağa katılma başlatılıyor"));
   }
-  Serial.println();
-  Serial.println(F("-----------------------------------"));
+  LOG_HEX_AT(LOG_LEVEL_INFO, F("DEVEUI: "), DEVEUI, 8);
 }
 
 void LoraManager::loop() {
-  // RX Delay değerini her zaman kontrol et ve düzeltilmesini sağla
-  if (LMIC.rxDelay != 5) {
-    LMIC.rxDelay = 5; // ChirpStack'in yapılandırmasıyla eşleşmesi için sürekli 5 değerini zorla
-    Serial.println(F("RX Delay değeri 5'e sıfırlandı"));
+  PROFILE_SCOPE(PROF_LOOP);
+  
+  // REJOIN: join durum makinesi bağlantı kopmuş gibi kayıtlı oturumu siler
+  // ve yeni bir join başlatır
+  if (rejoinRequested.exchange(false)) {
+    LMIC_reset();
+    joined = false;
+    enterJoinState(JOIN_IDLE);
   }
   
-  // RX1 ve RX2 DR değerlerini kontrol et
-  if (LMIC.rx1DrOffset != 0) {  // SF7 ile almak için dr offset 0 olmalı
-    LMIC.rx1DrOffset = 0;
-    Serial.println(F("RX1 DR Offset değeri 0'a ayarlandı (SF7)"));
-  }
-  
-  if (LMIC.dn2Dr != DR_SF9) {
-    LMIC.dn2Dr = DR_SF9;
-    Serial.println(F("RX2 SF değeri SF9'a ayarlandı"));
-  }
-  
-  // MIC hatası kontrolü ve düzeltmesi
-  // Bazen JOIN_ACCEPT alınsa bile MIC doğrulama hatası nedeniyle işlenmeyebilir
-  // Bu özellikle OTAA JOIN sorunlarını çözmeye yardımcı olur
-  static uint32_t lastJoinCheckTime = 0;
-  if (!joined && (millis() - lastJoinCheckTime) > 10000) { // Her 10 saniyede bir
-    lastJoinCheckTime = millis();
-    
-    // OP_JOINING modu açıksa ve 30 sn geçtiyse, JOIN yanıtı gelmiş olabilir ancak MIC hatası olmuş olabilir
-    if ((LMIC.opmode & OP_JOINING) && (LMIC.txend != 0) && (os_getTime() - LMIC.txend > ms2osticks(30000))) {
-      Serial.println(F("JOIN_ACCEPT işleme sorununa karşı önlem alınıyor"));
-      Serial.println(F("JOIN yanıtı alınmış olabilir ancak MIC hatası nedeniyle işlenememiş olabilir"));
-      
-      if (displayInstance) {
-        displayInstance->addLogLine("JOIN RESET");
-      }
-      
-      // JOIN isteklerinin üst üste yeniden gönderimini sınırla
-      // Eğer JOIN_TXCOMPLETE göremedik ve 30 saniyeden uzun sürdüyse, JOIN'i tekrar başlat
-      LMIC_reset();
-      delay(1000); // Kısa bekle
-      
-      // Ayarları tekrar yap
-      LMIC_setClockError(MAX_CLOCK_ERROR * CLOCK_ERROR_PERCENTAGE / 100);
-      LMIC.rxDelay = 5;
-      LMIC.rx1DrOffset = 0;
-      LMIC.rxsyms = 50;
-      LMIC.dn2Dr = DR_SF9;
-      LMIC_setDrTxpow(DR_SF9, 14);
-      
-      // ADR ve LinkCheck devre dışı
-      LMIC_setAdrMode(0);
-      LMIC_setLinkCheckMode(0);
-      
-      // OTAA JOIN'i tekrar başlat
-      Serial.println(F("OTAA JOIN tekrar başlatılıyor"));
-      LMIC_startJoining();
-    }
-  }
+  // Join durum makinesini ilerlet (bloklamaz)
+  updateJoinState();
   
   // Alıcı ayarlarını agresif tutmak için
   static uint32_t lastRxAdjustTime = 0;
-  if (millis() - lastRxAdjustTime > 1000) { // Her saniye
-    lastRxAdjustTime = millis();
-    
-    // LoRa alıcı hassasiyetini artır
-    LMIC.rxsyms = 50; // Sürekli uzun sembol süresi
+  if (Utils::getTimestamp() - lastRxAdjustTime > 1000) { // Her saniye
+    lastRxAdjustTime = Utils::getTimestamp();
     
     // Özellikle JOIN sürecinde, RXRX_PEND durumunda daha detaylı log
     if (!joined && (LMIC.opmode & OP_TXRXPEND)) {
-      Serial.print(F("RX Modu Aktif, opmode=0x"));
-      Serial.print(LMIC.opmode, HEX);
-      Serial.print(F(", freq="));
-      Serial.print(LMIC.freq);
-      Serial.print(F(", dataLen="));
-      Serial.print(LMIC.dataLen);
+      LOG_RECORD(LOG_LEVEL_DEBUG, LOG_RX_ACTIVE, LMIC.opmode, LMIC.freq, LMIC.dataLen);
       
-      if (displayInstance) {
+      if (Log::enabled(LOG_LEVEL_DEBUG) && displayManager) {
         char buffer[32];
         snprintf(buffer, sizeof(buffer), "RX: %u, %u", LMIC.freq, LMIC.dataLen);
-        displayInstance->showDebugInfo(buffer);
+        displayProxy.showDebugInfo(buffer);
       }
       
       // RX verisi varsa detaylı göster
       if (LMIC.dataLen > 0) {
-        Serial.print(F("RX Data: "));
-        for (int i = 0; i < LMIC.dataLen; i++) {
-          if (LMIC.frame[LMIC.dataBeg + i] < 0x10) Serial.print('0');
-          Serial.print(LMIC.frame[LMIC.dataBeg + i], HEX);
-          Serial.print(' ');
-        }
-        Serial.println();
+        LOG_RECORD_BYTES(LOG_LEVEL_DEBUG, LOG_RX_DATA_BYTES, LMIC.frame + LMIC.dataBeg, LMIC.dataLen);
         
-        if (displayInstance) {
-          displayInstance->addLogLine("RX DATA ALINDI!");
+        if (displayManager) {
+          displayProxy.addLogLine("RX DATA ALINDI!");
         }
       }
     }
   }
   
   // LMIC işlemlerini yürüt
-  os_runloop_once();
+  {
+    PROFILE_SCOPE(PROF_RUNLOOP);
+    os_runloop_once();
+  }
+  
+  // handleEvent'te biriken olayları LMIC bağlamının dışında teslim et
+  dispatchEvents();
   
-  // Debug bilgilerini ekrana yazdır
+  // Oturum ve sayaç değişikliklerini radyo boştayken kalıcı hale getir
+  persistSession();
+  
+  // Debug bilgilerini ekrana yazdır (yalnızca debug derlemesinde)
   static uint32_t lastDebugTime = 0;
-  if (millis() - lastDebugTime > 5000) {  // Her 5 saniyede bir
-    lastDebugTime = millis();
-    Serial.print("LMIC opmode: 0x");
-    Serial.println(LMIC.opmode, HEX);
+  if (Log::enabled(LOG_LEVEL_DEBUG) && Utils::getTimestamp() - lastDebugTime > 5000) {  // Her 5 saniyede bir
+    lastDebugTime = Utils::getTimestamp();
+    // opmode, RX pencereleri ve JOIN durumu
+    LOG_RECORD(LOG_LEVEL_DEBUG, LOG_STATUS, LMIC.opmode, LMIC.rxDelay, LMIC.dn2Dr, joined);
     
-    if (displayInstance) {
-      String debugInfo = "Opmode: 0x" + String(LMIC.opmode, HEX);
-      displayInstance->showDebugInfo(debugInfo.c_str());
+    if (displayManager) {
+      char buffer[32];
+      snprintf(buffer, sizeof(buffer), "Opmode: 0x%x", (unsigned)LMIC.opmode);
+      displayProxy.showDebugInfo(buffer);
     }
-    
-    // RX pencereleri ve JOIN durumu hakkında ek bilgiler
-    Serial.print("RX delay: ");
-    Serial.println(LMIC.rxDelay);
-    Serial.print("DN2Dr (RX2 SF): ");
-    Serial.println(LMIC.dn2Dr);
-    Serial.print("Joined: ");
-    Serial.println(joined ? "Yes" : "No");
   }
   
   // JOIN işleminde RX pencereleri için özel mantık
@@ -262,168 +185,406 @@ void LoraManager::loop() {
     if (LMIC.opmode & OP_TXRXPEND) {
       // Her 1 saniyede durum kontrol et
       static uint32_t lastRxCheckTime = 0;
-      if (millis() - lastRxCheckTime > 1000) {
-        lastRxCheckTime = millis();
+      if (Utils::getTimestamp() - lastRxCheckTime > 1000) {
+        lastRxCheckTime = Utils::getTimestamp();
         
-        Serial.print(F("JOIN TX sonrası bekleme, opmode=0x"));
-        Serial.println(LMIC.opmode, HEX);
-        Serial.print(F("RX1 penceresi açılma zamanı: "));
-        Serial.println(LMIC.rxtime);
+        // Şu anki OSTIME ve RXTIME arasındaki farkı bul
+        ostime_t now = os_getTime();
         
-        if (displayInstance) {
+        if (Log::enabled(LOG_LEVEL_DEBUG) && displayManager) {
           char buffer[32];
-          snprintf(buffer, sizeof(buffer), "RXT: %lu", LMIC.rxtime);
-          displayInstance->showDebugInfo(buffer);
+          snprintf(buffer, sizeof(buffer), "RXT: %lu", (unsigned long)LMIC.rxtime);
+          displayProxy.showDebugInfo(buffer);
         }
         
-        // Şu anki OSTIME ve RXTIME arasındaki farkı bul
-        ostime_t now = os_getTime();
-        Serial.print(F("Şu anki os_time: "));
-        Serial.println(now);
+        // RX1 penceresi açılana kadar kalan süre (tick olarak)
+        LOG_RECORD(LOG_LEVEL_DEBUG, LOG_JOIN_WAIT, LMIC.opmode, LMIC.rxtime, now, LMIC.rxtime - now);
         
         if (LMIC.rxtime > 0) {
-          // RX1 penceresi açılana kadar kalan süre (tick olarak)
           ostime_t delta = LMIC.rxtime - now;
-          Serial.print(F("RX1 penceresine kalan (tick): "));
-          Serial.println(delta);
           
           // Saniye olarak dönüştür (yaklaşık)
           float seconds = osticks2ms(delta) / 1000.0; // ms -> saniye
-          Serial.print(F("RX1 penceresine kalan (sn): "));
-          Serial.println(seconds);
           
-          if (displayInstance) {
+          if (Log::enabled(LOG_LEVEL_DEBUG) && displayManager) {
             char buffer[32];
             snprintf(buffer, sizeof(buffer), "RX1: %.2f sn", seconds);
-            displayInstance->showDebugInfo(buffer);
+            displayProxy.showDebugInfo(buffer);
           }
           
           // RX1 ile RX2 arasındaki zaman yaklaşık 1 saniyedir
           // RX1 zamanı geçtiyse
           if (delta <= 0) {
-            Serial.println(F("RX1 penceresi açık veya geçti"));
+            LOG_RECORD(LOG_LEVEL_DEBUG, LOG_RX1_PASSED);
             
-            if (displayInstance) {
-              displayInstance->addLogLine("RX1 acik/gecti");
+            if (displayManager) {
+              displayProxy.addLogLine("RX1 acik/gecti");
             }
             
             // RX2 penceresi kontrol
             if (now >= LMIC.rxtime + ms2osticks(6000)) { // 5+1 sn = 6000 ms
-              Serial.println(F("RX2 penceresi de geçti"));
+              LOG_RECORD(LOG_LEVEL_DEBUG, LOG_RX2_PASSED);
               
-              if (displayInstance) {
-                displayInstance->addLogLine("RX2 gecti");
+              if (displayManager) {
+                displayProxy.addLogLine("RX2 gecti");
               }
             } else {
-              Serial.println(F("RX2 penceresi için hazırlanıyor veya açık"));
-              LMIC.dn2Dr = DR_SF9; // RX2 SF değerini ayarla
+              LOG_RECORD(LOG_LEVEL_DEBUG, LOG_RX2_PENDING);
               
-              if (displayInstance) {
-                displayInstance->addLogLine("RX2 acik/hazirlaniyor");
+              if (displayManager) {
+                displayProxy.addLogLine("RX2 acik/hazirlaniyor");
               }
             }
           }
         }
         
-        // RX pencerelerini açık tut
-        LMIC.rxsyms = 50; // Önceki: 30 - şimdi 50 (daha uzun)
-        
-        // ÖNEMLİ: JOIN_ACCEPT'i alabilmek için RX2 DR değerini RX2 penceresi hemen açılmadan önce ayarla
-        // RX1 zamanı geçtiyse (rxtime'dan 5 sn sonra), RX2 penceresi yaklaşıyor demektir
+        // RX2 veri hızı LMIC_reset sonrası radyo profilinden yazıldı; RX1 geçtiyse
+        // (rxtime'dan 5 sn sonra) RX2 penceresinin kullanacağı değer raporlanır
         if (LMIC.rxtime > 0 && now >= LMIC.rxtime + ms2osticks(5000)) { // 5 saniye = 5000 ms
-          // RX1 penceresi geçti, RX2 penceresi açılmak üzere veya açık
-          Serial.println(F("RX2 penceresi zamanı - RX2 SF değeri SF9 olarak ayarlanıyor"));
-          LMIC.dn2Dr = DR_SF9;
-          
-          if (displayInstance) {
-            displayInstance->addLogLine("RX2 SF9 ayarlandi");
-          }
+          LOG_RECORD(LOG_LEVEL_DEBUG, LOG_RX2_DR_SET, LMIC.dn2Dr);
         }
         
         // RX durumunu yaz 
-        Serial.print(F("RxDelay: "));
-        Serial.print(LMIC.rxDelay);
-        Serial.print(F(", RX1DrOffset: "));
-        Serial.print(LMIC.rx1DrOffset);
-        Serial.print(F(", DN2Dr: "));
-        Serial.println(LMIC.dn2Dr);
+        LOG_RECORD(LOG_LEVEL_DEBUG, LOG_RX_PARAMS, LMIC.rxDelay, LMIC.rx1DrOffset, LMIC.dn2Dr);
       }
     }
   }
   
-  // Ağa bağlanma durumunu kontrol et ve gerekirse yeniden başlat
-  static uint32_t lastResetTime = 0;
-  if (!joined) {
-    // Eğer 90 saniye geçti ve hala bağlanmadıysak
-    if (millis() - lastResetTime > 90000) {
-      lastResetTime = millis();
-      Serial.println(F("Yeniden LMIC reset ve JOIN başlatılıyor"));
-      
-      // Ekrana bilgi göster
-      if (displayInstance) {
-        displayInstance->addLogLine("LMIC reset yapiliyor");
+#if !DUAL_CORE_MODE
+  // Tek çekirdekte ekran ve log aynı döngüde, radyo açısından kritik olmayan
+  // anda işlenir; çift çekirdekte bunu UI görevi yapar
+  serviceUi(isRadioCritical());
+#endif
+}
+
+void LoraManager::serviceUi(bool radioBusy) {
+  // Radyo tarafının kuyruğa eklediği ekran komutları ve log kayıtları burada tüketilir
+  if (displayManager) {
+    displayProxy.applyTo(*displayManager);
+    displayManager->service(radioBusy);
+  }
+  if (Log::enabled(LOG_LEVEL_ERROR) && !radioBusy) {
+    LogRing::flush(Serial);
+  }
+}
+
+void LoraManager::resetRadio() {
+  LMIC_reset();
+  
+  // Bölge kanal planı (CFG_* ile seçilir, bkz. RegionPlan.h); uyumsuz kanallar
+  // LOG_REGION_MISMATCH ile kaydedilir. Yalnızca sıfırlamadan sonra uygulanır:
+  // join-accept'in CFList kanalları ağın planıdır ve join sonrası ezilmemelidir
+  Region::apply();
+  
+  applyRadioConfig();
+}
+
+void LoraManager::applyRadioConfig() {
+  // ESP32 saat hatası: kalibre edilene kadar CLOCK_ERROR_PERCENTAGE, sonra ölçülen
+  // değer. LMIC RX penceresini ve rxsyms'i buna göre kendisi hesaplar.
+  rxCalibration.apply();
+  
+  // RX pencereleri, veri hızı ve güç: LMIC_reset sonrası tümü profilden; join
+  // sonrası sunucunun kazandığı parametreler join-accept'teki değerde kalır
+  if (joined) {
+    radioProfile.applyJoined();
+  } else {
+    radioProfile.applyReset();
+  }
+  
+  // ADR ve LinkCheck devre dışı
+  LMIC_setAdrMode(0);
+  LMIC_setLinkCheckMode(0);
+}
+
+bool LoraManager::isIdle() const {
+  const uint16_t busy = OP_TXDATA | OP_TXRXPEND | OP_JOINING | OP_POLL | OP_REJOIN;
+  return joined && !(LMIC.opmode & busy) && eventQueue.isEmpty() &&
+         !sessionDirty && !countersDirty && !rejoinRequested;
+}
+
+uint32_t LoraManager::msUntilNextJob(uint32_t horizonMs) {
+  if (!os_queryTimeCriticalJobs(msToTicks(horizonMs))) {
+    return horizonMs;
+  }
+  
+  // LMIC yalnızca "bu süre içinde iş var mı" sorusunu yanıtlar; yanıt süreyle
+  // monoton olduğundan en erken iş ikili aramayla (~22 sorgu) bulunur
+  uint32_t low = 0;
+  uint32_t high = horizonMs;
+  while (high - low > 1) {
+    uint32_t mid = low + (high - low) / 2;
+    if (os_queryTimeCriticalJobs(msToTicks(mid))) {
+      high = mid;
+    } else {
+      low = mid;
+    }
+  }
+  return low;
+}
+
+void LoraManager::suspend(uint32_t sleepMs) {
+#if defined(ESP32)
+  // Uyandıktan sonra os_getTime ve millis sıfırdan başlar; bant ve görev
+  // döngüsü zamanları uyku süresi kadar geriye kaydırılır. Açılış süresi
+  // hesaba katılmadığı için bantlar gerektiğinden biraz geç açılır (güvenli yön)
+  ostime_t shift = os_getTime() + msToTicks(sleepMs);
+  sleepState.lmic = LMIC;
+#if CFG_LMIC_EU_like
+  for (uint8_t band = 0; band < MAX_BANDS; band++) {
+    sleepState.lmic.bands[band].avail -= shift;
+  }
+  sleepState.lmic.globalDutyAvail -= shift;
+#endif
+  
+  DutyCycleLedger ledger = dutyCycle;
+  ledger.shiftClock(Utils::getTimestamp() + sleepMs);
+  memcpy(sleepState.dutyCycle, &ledger, sizeof(ledger));
+  memcpy(sleepState.rxCalibration, &rxCalibration, sizeof(rxCalibration));
+  
+  sessionCounters.seqnoUp = LMIC.seqnoUp;
+  sessionCounters.seqnoDn = LMIC.seqnoDn;
+  sleepState.counters = sessionCounters;
+  sleepState.session = savedSession;
+  sleepState.magic = SESSION_MAGIC;
+#else
+  (void)sleepMs;
+#endif
+  
+  // Radyoyu uyku moduna al; LMIC işleri durur
+  LMIC_shutdown();
+}
+
+bool LoraManager::resumeFromSleep() {
+#if defined(ESP32)
+  if (!LowPower::wokeFromDeepSleep() || sleepState.magic != SESSION_MAGIC) {
+    return false;
+  }
+  
+  // Aynı durum ikinci kez kullanılmasın (ör. uyanıştan sonra çökme)
+  sleepState.magic = 0;
+  
+  LMIC = sleepState.lmic;
+  LMIC_registerEventCb(onLmicEvent, this);
+  radioProfile.applyJoined();
+  memcpy(&dutyCycle, sleepState.dutyCycle, sizeof(dutyCycle));
+  memcpy(&rxCalibration, sleepState.rxCalibration, sizeof(rxCalibration));
+  sessionCounters = sleepState.counters;
+  savedSession = sleepState.session;
+  
+#if SESSION_PERSISTENCE
+  sessionStore.begin();
+#endif
+  
+  joined = true;
+  
+  LOG_RECORD(LOG_LEVEL_INFO, LOG_SLEEP_RESUMED, LMIC.devaddr, LMIC.seqnoUp);
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool LoraManager::restoreSession() {
+#if SESSION_PERSISTENCE
+  if (!sessionStore.begin()) {
+    return false;
+  }
+  
+  // Sayaç kaydı yoksa FCnt bilinmez; oturum olsa bile güvenle kullanılamaz
+  if (!sessionStore.loadCounters(sessionCounters)) {
+    memset(&sessionCounters, 0, sizeof(sessionCounters));
+    return false;
+  }
+  
+  LoraSession session;
+  if (!sessionStore.loadSession(session)) {
+    return false;
+  }
+  
+  SessionStore::restore(session);
+  savedSession = session;
+  radioProfile.applyJoined();
+  
+  // Son kayıttan sonra en fazla SESSION_FCNT_SAVE_INTERVAL çerçeve gönderilmiş
+  // olabilir; ağ tekrar eden FCnt'yi reddettiği için sayaç o kadar ileri atlanır.
+  // Atlanan değer hemen yazılır, art arda yeniden açılışlarda da ilerlemeye devam eder.
+  LMIC.seqnoUp = sessionCounters.seqnoUp + SESSION_FCNT_SAVE_INTERVAL;
+  LMIC.seqnoDn = sessionCounters.seqnoDn;
+  sessionCounters.seqnoUp = LMIC.seqnoUp;
+  countersDirty = true;
+  joined = true;
+  
+  LOG_RECORD(LOG_LEVEL_INFO, LOG_SESSION_RESTORED, session.devAddr, LMIC.seqnoUp, LMIC.seqnoDn, sessionCounters.devNonce);
+  return true;
+#else
+  return false;
+#endif
+}
+
+void LoraManager::persistSession() {
+#if SESSION_PERSISTENCE
+  // Flash yazması milisaniyeler sürebilir; TX ve RX pencereleri sırasında yapılmaz
+  if (LMIC.opmode & OP_TXRXPEND) {
+    return;
+  }
+  
+  bool sessionWritten = false;
+  if (joined) {
+    // FCnt her uplink'te değil, SESSION_FCNT_SAVE_INTERVAL çerçevede bir yazılır
+    if (LMIC.seqnoUp - sessionCounters.seqnoUp >= SESSION_FCNT_SAVE_INTERVAL) {
+      countersDirty = true;
+    }
+    
+    if (sessionDirty || countersDirty) {
+      // Ağın MAC komutlarıyla değiştirdiği kanal/ADR durumu sayaç kaydıyla
+      // birlikte yakalanır; oturum kaydı yalnızca gerçekten değiştiyse yazılır
+      LoraSession current;
+      SessionStore::capture(current);
+      if (sessionDirty || memcmp(&current, &savedSession, offsetof(LoraSession, checksum)) != 0) {
+        sessionStore.saveSession(current);
+        savedSession = current;
+        sessionWritten = true;
       }
       
-      // Kısa bir bekleme
-      delay(1000);
-      
-      // LMIC'yi tamamen yeniden başlat
-      LMIC_reset();
-      
-      // Kısa bir bekleme
-      delay(500);
-      
-      // ESP32 saat hatası düzeltmesi
-      LMIC_setClockError(MAX_CLOCK_ERROR * CLOCK_ERROR_PERCENTAGE / 100);
-      
-      // Kısa bir bekleme
-      delay(500);
-      
-      // RX pencerelerini yapılandır - JOIN_ACCEPT zaman penceresi için önemli
-      LMIC.rxDelay = 5;         // RX1 gecikmesi (saniye)
-      LMIC.rx1DrOffset = 0;     // RX1 veri hızı ofseti - SF7 için 0
-      LMIC.rxsyms = 50;         // RX sembolleri için ek bekleme süresi
-      LMIC.dn2Dr = DR_SF9;      // RX2 için Spreading Factor
-      
-      // Tüm JOIN işlemleri için bu parametreleri sabit tut
-      LMIC.dataBeg = 0;
-      LMIC.dataLen = 0;
-      LMIC.pendTxPort = 0;
-      LMIC.pendTxConf = 0;
-      
-      // JOIN için SF9 kullan - Daha güvenilir iletişim
-      LMIC_setDrTxpow(DR_SF9, 14); // Önceki: SF7
-      
-      // ADR ve LinkCheck devre dışı
-      LMIC_setAdrMode(0);
-      LMIC_setLinkCheckMode(0);
-      
-      // Veri gönderme hızını da SF9'a ayarla
-      LMIC.datarate = DR_SF9;
-      
-      // Kısa bir bekleme
-      delay(500);
-      
-      // JOIN isteği gönder
-      LMIC_startJoining();
-      
-      Serial.println(F("JOIN yeniden başlatıldı"));
-      
-      if (displayInstance) {
-        displayInstance->addLogLine("JOIN yeniden basladi");
+      sessionCounters.seqnoUp = LMIC.seqnoUp;
+      sessionCounters.seqnoDn = LMIC.seqnoDn;
+      countersDirty = true;
+    }
+  }
+  
+  if (countersDirty) {
+    sessionStore.saveCounters(sessionCounters);
+    LOG_RECORD(LOG_LEVEL_DEBUG, LOG_SESSION_SAVED, sessionWritten, sessionCounters.seqnoUp, sessionCounters.devNonce, sessionStore.getWrites());
+  }
+  
+  sessionDirty = false;
+  countersDirty = false;
+#endif
+}
+
+void LoraManager::startJoin() {
+  // LMIC_reset DevNonce'u sıfırlar; ağ daha önce gördüğü DevNonce ile gelen
+  // join isteğini reddeder, bu yüzden kayıtlı değerden devam edilir
+  if (LMIC.devNonce < sessionCounters.devNonce) {
+    LMIC.devNonce = sessionCounters.devNonce;
+  }
+  LMIC_startJoining();
+}
+
+void LoraManager::forgetSession() {
+  rejoinRequested = true;
+}
+
+void LoraManager::enterJoinState(JoinState state) {
+  joinState = state;
+  joinStateSince = Utils::getTimestamp();
+}
+
+uint32_t LoraManager::nextJoinBackoff() const {
+  // Üstel geri çekilme: taban * 2^(deneme-1), üst sınırla kırpılır
+  uint32_t backoff = JOIN_BACKOFF_BASE_MS;
+  for (uint8_t i = 1; i < joinAttempts && backoff < JOIN_BACKOFF_MAX_MS; i++) {
+    backoff *= 2;
+  }
+  if (backoff > JOIN_BACKOFF_MAX_MS) {
+    backoff = JOIN_BACKOFF_MAX_MS;
+  }
+  
+  // Saha genelinde elektrik kesintisinden sonra cihazların senkronize
+  // denemesini önlemek için +/- %25 rastgele sapma ekle
+  uint32_t jitter = backoff / 4;
+  backoff = backoff - jitter + random(0, 2 * jitter + 1);
+  
+  // LoRaWAN join-request görev döngüsü kuralı (toplam yayın süresi):
+  // ilk saat %1, 1-11 saat arası %0.1, sonrasında %0.01
+  uint32_t elapsed = Utils::getTimestamp() - firstJoinTime;
+  uint32_t dutyDivider;
+  if (elapsed < 3600000UL) {
+    dutyDivider = 100;
+  } else if (elapsed < 11UL * 3600000UL) {
+    dutyDivider = 1000;
+  } else {
+    dutyDivider = 10000;
+  }
+  // Join-request PHY yükü 23 byte; uplinkAirtimeMs LORAWAN_FRAME_OVERHEAD (13) ekler
+  uint32_t minInterval = DutyCycleLedger::uplinkAirtimeMs(LMIC.datarate, 10) * dutyDivider;
+  
+  return backoff > minInterval ? backoff : minInterval;
+}
+
+void LoraManager::updateJoinState() {
+  uint32_t now = Utils::getTimestamp();
+  
+  if (joined) {
+    if (joinState != JOIN_IDLE) {
+      enterJoinState(JOIN_IDLE);
+      joinAttempts = 0;
+    }
+    return;
+  }
+  
+  switch (joinState) {
+    case JOIN_IDLE:
+      // Bağlantı koptu (ör. EV_LINK_DEAD): kayıtlı oturum artık geçersiz,
+      // hemen yeni bir join başlat
+#if SESSION_PERSISTENCE
+      sessionStore.clearSession();
+#endif
+      firstJoinTime = now;
+      joinAttempts = 0;
+      enterJoinState(JOIN_BACKOFF);
+      joinBackoffMs = 0;
+      break;
+    
+    case JOIN_IN_PROGRESS: {
+      // JOIN_ACCEPT alınmış ancak MIC hatası nedeniyle işlenememiş olabilir:
+      // join TX'i bitmiş ve 30 saniyedir yanıt yoksa deneme takılmış demektir
+      bool stalled = (LMIC.opmode & OP_JOINING) && (LMIC.txend != 0) &&
+                     (os_getTime() - LMIC.txend > ms2osticks(JOIN_STALL_TIMEOUT_MS));
+      bool timedOut = (now - joinStateSince) > JOIN_ATTEMPT_TIMEOUT_MS;
+      
+      if (stalled || timedOut) {
+        // Radyoyu hemen durdur; yeniden deneme zamanlayıcıyla yapılır
+        LMIC_reset();
+        joinBackoffMs = nextJoinBackoff();
+        enterJoinState(JOIN_BACKOFF);
+        
+        LOG_RECORD(LOG_LEVEL_ERROR, LOG_JOIN_RETRY, stalled, joinBackoffMs);
+        
+        if (displayManager) {
+          displayProxy.addLogLine("JOIN RESET");
+        }
       }
+      break;
     }
+    
+    case JOIN_BACKOFF:
+      if ((now - joinStateSince) >= joinBackoffMs) {
+        // LMIC_reset sonrası tüm ayarlar tek noktadan tekrar uygulanır
+        resetRadio();
+        startJoin();
+        joinAttempts++;
+        enterJoinState(JOIN_IN_PROGRESS);
+        
+        LOG_RECORD(LOG_LEVEL_INFO, LOG_JOIN_RESTART, joinAttempts);
+        
+        if (displayManager) {
+          displayProxy.addLogLine("JOIN yeniden basladi");
+        }
+      }
+      break;
   }
 }
 
 bool LoraManager::sendData(uint8_t* data, uint8_t size, uint8_t port, bool confirmed) {
   // Veri göndermek için önce ağa bağlı olduğumuzdan emin olalım
   if (!isJoined()) {
-    Serial.println(F("Veri gönderilemiyor: Ağa bağlı değil"));
+    LOG_RECORD(LOG_LEVEL_ERROR, LOG_SEND_REJECTED, 0, 0);
     
     // Ekrana bilgi göster
-    if (displayInstance) {
-      displayInstance->showSendStatus("Aga bagli degil", false);
+    if (displayManager) {
+      displayProxy.showSendStatus("Aga bagli degil", false);
     }
     
     return false;
@@ -431,11 +592,22 @@ bool LoraManager::sendData(uint8_t* data, uint8_t size, uint8_t port, bool confi
   
   // Başka bir iletim bekleniyorsa, gönderme
   if (LMIC.opmode & OP_TXRXPEND) {
-    Serial.println(F("Veri gönderilemiyor: İşlem devam ediyor"));
+    LOG_RECORD(LOG_LEVEL_ERROR, LOG_SEND_REJECTED, 1, 0);
     
     // Ekrana bilgi göster
-    if (displayInstance) {
-      displayInstance->showSendStatus("Islem devam ediyor", false);
+    if (displayManager) {
+      displayProxy.showSendStatus("Islem devam ediyor", false);
+    }
+    
+    return false;
+  }
+  
+  // Yük geçerli veri hızının sınırını aşıyorsa LMIC çerçeveyi kesemez
+  if (size > getMaxPayloadSize()) {
+    LOG_RECORD(LOG_LEVEL_ERROR, LOG_SEND_REJECTED, 2, getMaxPayloadSize());
+    
+    if (displayManager) {
+      displayProxy.showSendStatus("Yuk cok buyuk", false);
     }
     
     return false;
@@ -448,22 +620,92 @@ bool LoraManager::sendData(uint8_t* data, uint8_t size, uint8_t port, bool confi
     LMIC_setTxData2(port, data, size, 0); // Onaysız mesaj
   }
   
-  Serial.println(F("Paket kuyruğa alındı"));
+  LOG_RECORD(LOG_LEVEL_INFO, LOG_SEND_QUEUED, port, size, confirmed);
   
   // Ekrana bilgi göster
-  if (displayInstance) {
-    displayInstance->showSendStatus("Paket kuyrukta", true);
+  if (displayManager) {
+    displayProxy.showSendStatus("Paket kuyrukta", true);
   }
   
   return true;
 }
 
-void LoraManager::setEventCallback(LoraEventCallback callback) {
-  eventCallback = callback;
+uint8_t LoraManager::getMaxPayloadSize() const {
+  return Region::maxPayload(LMIC.datarate);
+}
+
+bool LoraManager::subscribe(uint32_t eventMask, LoraEventHandler handler, void* context) {
+  return eventBus.subscribe(eventMask, handler, context);
+}
+
+bool LoraManager::unsubscribe(LoraEventHandler handler, void* context) {
+  return eventBus.unsubscribe(handler, context);
+}
+
+void LoraManager::setDownlinkHandler(LoraDownlinkHandler handler, void* context) {
+  downlinkHandler = handler;
+  downlinkContext = context;
 }
 
-void LoraManager::setTxCompleteCallback(LoraTxCompleteCallback callback) {
-  txCompleteCallback = callback;
+LoraEventQueueStats LoraManager::getEventQueueStats() const {
+  LoraEventQueueStats stats;
+  stats.dispatched = eventsDispatched;
+  stats.dropped = eventQueue.getDropped();
+  stats.staleDownlinks = staleDownlinks;
+  stats.pending = eventQueue.size();
+  stats.maxDepth = eventQueueMaxDepth;
+  return stats;
+}
+
+void LoraManager::enqueueEvent(ev_t ev) {
+  LoraEvent event;
+  event.timestamp = Utils::getTimestamp();
+  event.ev = (uint8_t)ev;
+  event.txrxFlags = LMIC.txrxFlags;
+  event.port = 0;
+  event.dataLen = 0;
+  event.success = ev == EV_TXCOMPLETE;
+  event.frameSeq = txFrameSeq;
+  event.data = nullptr;
+  
+  // LMIC.frame downlink'i bir sonraki gönderime kadar tutar; yük kopyalanmaz,
+  // dispatchEvents frameSeq ile hâlâ geçerli olduğunu denetler
+  if (ev == EV_TXCOMPLETE && (LMIC.txrxFlags & TXRX_PORT)) {
+    event.port = LMIC.frame[LMIC.dataBeg - 1];
+    event.dataLen = LMIC.dataLen;
+    event.data = LMIC.frame + LMIC.dataBeg;
+  }
+  
+  // Yer yoksa kayıt atılır ve getEventQueueStats().dropped ile sayılır
+  eventQueue.push(event);
+  
+  uint16_t depth = eventQueue.size();
+  if (depth > eventQueueMaxDepth) {
+    eventQueueMaxDepth = depth;
+  }
+}
+
+void LoraManager::dispatchEvents() {
+  LoraEvent event;
+  
+  while (eventQueue.pop(event)) {
+    if (event.data && event.frameSeq != txFrameSeq) {
+      // Teslimden önce yeni bir gönderim LMIC.frame'i yeniden yazdı
+      event.data = nullptr;
+      event.dataLen = 0;
+      staleDownlinks++;
+    } else if (event.data && downlinkHandler) {
+      // Yük aboneler çağrılmadan okunur; bir abone uplink başlatırsa frame ezilir
+      downlinkHandler(downlinkContext, event.port, event.payload());
+      if (event.frameSeq != txFrameSeq) {
+        event.data = nullptr;
+        event.dataLen = 0;
+      }
+    }
+    
+    eventBus.publish(event.ev, event);
+    eventsDispatched++;
+  }
 }
 
 bool LoraManager::isJoined() const {
@@ -474,77 +716,115 @@ lmic_t* LoraManager::getLMIC() {
   return &LMIC;
 }
 
+bool LoraManager::isRadioCritical() {
+  if (!(LMIC.opmode & OP_TXRXPEND)) {
+    txInFlight = false;
+    return false;
+  }
+  
+  // DIO kesme yerine yoklama kullanıldığından TX bitişi os_runloop_once ile
+  // algılanır; bu gecikirse RX pencereleri de kayar
+  if (txInFlight) {
+    if (LMIC.txend == txEndAtStart) {
+      return true;
+    }
+    txInFlight = false;
+  }
+  
+  // RX1 açılmadan hemen önce ile RX2 penceresi (RX1 + 1 sn) sonrasına kadar
+  ostime_t untilRx1 = LMIC.rxtime - os_getTime();
+  return untilRx1 < ms2osticks(DISPLAY_RADIO_GUARD_MS) &&
+         untilRx1 > -ms2osticks(1000 + DISPLAY_RADIO_GUARD_MS);
+}
+
+DutyCycleLedger& LoraManager::getDutyCycleLedger() {
+  return dutyCycle;
+}
+
+EventTrace& LoraManager::getEventTrace() {
+  return eventTrace;
+}
+
+const RxCalibration& LoraManager::getRxCalibration() const {
+  return rxCalibration;
+}
+
+RadioProfile& LoraManager::getRadioProfile() {
+  return radioProfile;
+}
+
 void LoraManager::setDisplayManager(DisplayManager* display) {
-  displayInstance = display;
+  displayManager = display;
+}
+
+void LoraManager::onLmicEvent(void* userData, ev_t ev) {
+  static_cast<LoraManager*>(userData)->handleEvent(ev);
 }
 
-void LoraManager::onEvent(ev_t ev) {
-  if (loraManagerInstance == nullptr) return;
+void LoraManager::handleEvent(ev_t ev) {
+  PROFILE_SCOPE(PROF_ON_EVENT);
   
-  Serial.print(F("LoRa Olayı: "));
+  // Zamanlama analizi için olay anındaki LMIC durumunu kaydet
+  eventTrace.record(ev);
+  
+  // Radyo zamanlamasına duyarlı bağlamda Serial'a yazma; kayıt ertelenmiş olarak basılır
+  LOG_RECORD(LOG_LEVEL_INFO, LOG_LMIC_EVENT, ev, LMIC.opmode, joined);
   char logBuffer[32] = {0};
   
   switch(ev) {
     case EV_JOINING:
-      Serial.println(F("Ağa katılma başlatıldı"));
       strncpy(logBuffer, "Aga katilma basladi", 31);
       break;
     
     case EV_JOINED:
-      Serial.println(F("Ağa katıldı"));
       strncpy(logBuffer, "Aga katildi!", 31);
-      loraManagerInstance->joined = true;
-      
-      // Veri gönderme modu için anahtar değişkenlerini ayarla
-      LMIC_setLinkCheckMode(0);
-      LMIC_setDrTxpow(DR_SF9, 14);
+      joined = true;
       
-      // JOIN sonrası RX parametrelerini açıkça tekrar ayarla
-      LMIC.rxDelay = 5;
-      LMIC.rx1DrOffset = 0;  // SF7 için dr offset = 0
-      LMIC.dn2Dr = DR_SF9;
+      // Yeni DevAddr ve anahtarlar loop() içinde kalıcı hale getirilir
+      sessionDirty = true;
       
-      // RX sembol sayısını artır
-      LMIC.rxsyms = 50;
+      // Join-accept'in geliş anı ilk zamanlama ölçümüdür
+      rxCalibration.onUplinkDone(true, false);
       
-      Serial.println(F("JOIN sonrası LMIC parametreleri tekrar yapılandırıldı"));
+      // JOIN sonrası RX ve veri hızı parametrelerini tek noktadan tekrar uygula;
+      // kanal planı join-accept'ten geldiği için yeniden uygulanmaz
+      applyRadioConfig();
       break;
     
     case EV_JOIN_FAILED:
-      Serial.println(F("Ağa katılma başarısız"));
       strncpy(logBuffer, "Katilma basarisiz", 31);
       break;
     
     case EV_REJOIN_FAILED:
-      Serial.println(F("Yeniden bağlanma başarısız"));
       strncpy(logBuffer, "Yeniden baglanti basarisiz", 31);
       break;
     
     case EV_TXCOMPLETE:
-      Serial.println(F("Veri gönderildi, iletim tamamlandı"));
       strncpy(logBuffer, "Veri gonderildi", 31);
       
+      // Pencerelerden birinde çerçeve alındıysa zamanlama ölçülür; onaylı
+      // uplink'e ACK gelmediyse pencere fazla dar olabilir
+      rxCalibration.onUplinkDone((LMIC.txrxFlags & (TXRX_DNW1 | TXRX_DNW2)) != 0,
+                                 (LMIC.txrxFlags & TXRX_NACK) != 0);
+      
+      // LMIC parametreleri yalnızca downlink'teki MAC komutlarıyla değişir;
+      // kabul edilen sunucu değişikliği oturum kaydına yazılır
+      if ((LMIC.txrxFlags & (TXRX_DNW1 | TXRX_DNW2)) && radioProfile.checkDrift()) {
+        sessionDirty = true;
+      }
+      
       if (LMIC.txrxFlags & TXRX_ACK) {
-        Serial.println(F("ACK alındı"));
+        LOG_RECORD(LOG_LEVEL_INFO, LOG_TX_ACK);
         strncat(logBuffer, " ACK alindi", 31 - strlen(logBuffer));
       }
       
       // Downlink mesajı varsa işle
       if (LMIC.dataLen) {
-        Serial.print(F("Veri alındı: "));
-        Serial.print(LMIC.dataLen);
-        Serial.println(F(" byte"));
-        
-        // Alınan veriyi hexadecimal olarak yazdır
-        Serial.print(F("Alınan veri (HEX): "));
-        for (int i = 0; i < LMIC.dataLen; i++) {
-          if (LMIC.frame[LMIC.dataBeg + i] < 0x10) Serial.print('0');
-          Serial.print(LMIC.frame[LMIC.dataBeg + i], HEX);
-          Serial.print(' ');
-        }
-        Serial.println();
+        // Alınan veri bayt bayt yazdırılmak yerine ham olarak kayda alınır
+        LOG_RECORD(LOG_LEVEL_INFO, LOG_DOWNLINK, LMIC.dataLen, (LMIC.txrxFlags & TXRX_PORT) ? LMIC.frame[LMIC.dataBeg - 1] : 0);
+        LOG_RECORD_BYTES(LOG_LEVEL_DEBUG, LOG_DOWNLINK_BYTES, LMIC.frame + LMIC.dataBeg, LMIC.dataLen);
         
-        if (displayInstance) {
+        if (displayManager) {
           char hexData[16] = {0};
           int maxChars = (LMIC.dataLen < 3) ? LMIC.dataLen : 3;
           for (int i = 0; i < maxChars; i++) {
@@ -553,88 +833,77 @@ void LoraManager::onEvent(ev_t ev) {
           
           char buffer[32];
           snprintf(buffer, sizeof(buffer), "RX: %s... %dB", hexData, LMIC.dataLen);
-          displayInstance->addLogLine(buffer);
+          displayProxy.addLogLine(buffer);
         }
       }
-      
-      // Geri çağırma işlevini çağır
-      if (loraManagerInstance->txCompleteCallback) {
-        loraManagerInstance->txCompleteCallback(true);
-      }
       break;
     
     case EV_TXSTART:
-      Serial.println(F("İletim başlatıldı"));
+      // LMIC.frame yeni çerçeveyle yazıldı; bekleyen downlink görünümleri geçersiz
+      txFrameSeq++;
+      
+      // Yayın süresini alt bant defterine işle (join istekleri dahil)
+      dutyCycle.recordCurrentTransmission();
+      txInFlight = true;
+      txEndAtStart = LMIC.txend;
+      rxCalibration.onTxStart((LMIC.opmode & OP_JOINING) != 0);
+      
+      // Bu join isteğinin DevNonce'u bir daha kullanılmamalı
+      if (LMIC.opmode & OP_JOINING) {
+        sessionCounters.devNonce = LMIC.devNonce + 1;
+        countersDirty = true;
+      }
       strncpy(logBuffer, "Iletim basladi", 31);
       break;
     
     case EV_TXCANCELED:
-      Serial.println(F("İletim iptal edildi"));
       strncpy(logBuffer, "Iletim iptal edildi", 31);
-      if (loraManagerInstance->txCompleteCallback) {
-        loraManagerInstance->txCompleteCallback(false);
-      }
       break;
     
     case EV_LINK_DEAD:
-      Serial.println(F("Bağlantı kesildi"));
       strncpy(logBuffer, "Baglanti kesildi", 31);
-      loraManagerInstance->joined = false;
+      joined = false;
       break;
       
     case EV_JOIN_TXCOMPLETE:
-      Serial.println(F("Join TX tamamlandı (yanıt bekliyor)"));
       strncpy(logBuffer, "Join TX tamamlandi", 31);
-      Serial.println(F("JOIN_TXCOMPLETE - Gelen yanıt dinleniyor"));
       
       // JOIN_ACCEPT işleme sürecini iyileştir
-      Serial.print(F("RxDelay: "));
-      Serial.println(LMIC.rxDelay);
-      Serial.print(F("RX1DrOffset: "));
-      Serial.println(LMIC.rx1DrOffset);
-      Serial.print(F("RxSyMs: "));
-      Serial.println(LMIC.rxsyms);
-      Serial.print(F("DN2Dr: "));
-      Serial.println(LMIC.dn2Dr);
+      LOG_RECORD(LOG_LEVEL_DEBUG, LOG_JOIN_RX_PARAMS, LMIC.rxDelay, LMIC.rx1DrOffset, LMIC.rxsyms, LMIC.dn2Dr);
       
-      // JOIN_ACCEPT işleme kapasitesini artır
-      LMIC.rxsyms = 50; // Çok daha fazla sembol bekleme
+      // Join-accept gelmedi; kalibre pencere fazla dar olabilir
+      rxCalibration.onUplinkDone(false, true);
       
       // RXMODE'u agresif olarak izle
-      Serial.print(F("RXMODE ayarlandı, freq="));
-      Serial.println(LMIC.freq);
+      LOG_RECORD(LOG_LEVEL_DEBUG, LOG_JOIN_TX_FREQ, LMIC.freq);
       
-      if (displayInstance) {
+      if (displayManager) {
         char buffer[32];
         snprintf(buffer, sizeof(buffer), "JOIN TX OK, f=%u", LMIC.freq);
-        displayInstance->addLogLine(buffer);
+        displayProxy.addLogLine(buffer);
       }
       break;
       
     // RX olaylarını ekleyelim
     case EV_RXSTART:
-      Serial.println(F("RX başladı - JOIN_ACCEPT dinleniyor"));
-      
-      if (displayInstance) {
-        displayInstance->addLogLine("RX basladi");
+      rxCalibration.onRxStart();
+      if (displayManager) {
+        displayProxy.addLogLine("RX basladi");
       }
       break;
     
     default:
-      Serial.print(F("Bilinmeyen olay: "));
-      Serial.println((unsigned) ev);
       snprintf(logBuffer, 32, "Bilinmeyen olay: %d", (int)ev);
       break;
   }
   
   // Ekrana log satırı ekle
-  if (displayInstance && logBuffer[0] != '\0') {
-    displayInstance->addLogLine(logBuffer);
-    displayInstance->showConnectionStatus(loraManagerInstance->joined);
+  if (displayManager && logBuffer[0] != '\0') {
+    displayProxy.addLogLine(logBuffer);
+    displayProxy.showConnectionStatus(joined);
   }
   
-  // Olay geri çağırma işlevini çağır
-  if (loraManagerInstance->eventCallback) {
-    loraManagerInstance->eventCallback(ev);
-  }
+  // Uygulama geri çağırmaları burada değil, loop() içinde dispatchEvents ile çağrılır;
+  // LMIC işlenirken yeni gönderim başlatılamaz
+  enqueueEvent(ev);
 } 
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include "../Core/Lora/LowPower.h"
+#include "../Core/Utils/LogRing.h"
+
+#if defined(ESP32)
+#include <esp_sleep.h>
+
+// Derin uykuda korunur; soğuk açılışta sıfırdır
+RTC_DATA_ATTR static SleepStats stats;
+#else
+static SleepStats stats;
+#endif
+
+uint32_t LowPower::awakeSince = 0;
+
+SleepPlan LowPower::plan(LoraManager& manager, uint32_t appWakeAt, bool appIdle) {
+  SleepPlan plan = { 0, false };
+
+  // TX/RX, join veya teslim bekleyen olay/kayıt varken uyunmaz
+  if (!manager.isIdle()) {
+    return plan;
+  }
+
+  uint32_t now = Utils::getTimestamp();
+  int32_t untilApp = (int32_t)(appWakeAt - now);
+  if (untilApp <= 0) {
+    return plan;
+  }
+  uint32_t duration = untilApp;
+
+  // Uygulamanın zamanı geldiğinde bant hâlâ kapalıysa o an uyanmak boşunadır
+  int32_t untilBand = (int32_t)(manager.getDutyCycleLedger().nextSendTime() - now);
+  if (untilBand > (int32_t)duration) {
+    duration = untilBand;
+  }
+  if (duration > LOW_POWER_MAX_SLEEP_MS) {
+    duration = LOW_POWER_MAX_SLEEP_MS;
+  }
+
+  // LMIC işi derin uykuda kaybolur; iş varsa yalnızca ona kadar hafif uyku
+  uint32_t untilJob = manager.msUntilNextJob(LOW_POWER_MAX_SLEEP_MS);
+  bool lmicIdle = untilJob >= LOW_POWER_MAX_SLEEP_MS;
+  if (!lmicIdle) {
+    uint32_t limit = untilJob > LOW_POWER_WAKE_MARGIN_MS ? untilJob - LOW_POWER_WAKE_MARGIN_MS : 0;
+    if (limit < duration) {
+      duration = limit;
+    }
+  }
+
+  if (duration < LOW_POWER_MIN_SLEEP_MS) {
+    return plan;
+  }
+  plan.durationMs = duration;
+  plan.deep = lmicIdle && appIdle && duration >= LOW_POWER_MIN_DEEP_SLEEP_MS;
+  return plan;
+}
+
+void LowPower::sleep(LoraManager& manager, DisplayManager* display, const SleepPlan& plan) {
+  if (plan.durationMs == 0) {
+    return;
+  }
+
+  recordCycle(Utils::getTimestamp() - awakeSince, plan.durationMs, plan.deep);
+
+  // Uykuda kaybolmaması için bekleyen log kayıtlarının hepsini yaz
+  if (Log::enabled(LOG_LEVEL_ERROR)) {
+    LogRing::flush(Serial, LOG_RING_CAPACITY);
+  }
+
+  bool displayWasOn = display && display->isOn();
+  if (display) {
+    display->turnOff();
+  }
+
+#if defined(ESP32)
+  Serial.flush();
+  esp_sleep_enable_timer_wakeup((uint64_t)plan.durationMs * 1000ULL);
+  if (plan.deep) {
+    // LMIC durumu RTC belleğine yazılır ve radyo uyutulur; cihaz setup()'tan
+    // başlar ve LoraManager::setup() join yapmadan devam eder
+    manager.suspend(plan.durationMs);
+    esp_deep_sleep_start();
+  }
+  esp_light_sleep_start();
+#else
+  // Host derlemesinde uyku yok; süre beklenerek benzetilir (RAM korunur)
+  (void)manager;
+  delay(plan.durationMs);
+#endif
+
+  awakeSince = Utils::getTimestamp();
+  if (displayWasOn) {
+    display->turnOn();
+  }
+}
+
+bool LowPower::wokeFromDeepSleep() {
+#if defined(ESP32)
+  return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER;
+#else
+  return false;
+#endif
+}
+
+const SleepStats& LowPower::getStats() {
+  return stats;
+}
+
+void LowPower::recordCycle(uint32_t awakeMs, uint32_t sleepMs, bool deep) {
+  // Derin uykudan sonra awakeSince 0'dır; uyanık süre açılıştan itibaren ölçülür
+  stats.cycles++;
+  if (deep) {
+    stats.deepCycles++;
+  }
+  stats.lastAwakeMs = awakeMs;
+  stats.totalAwakeMs += awakeMs;
+  stats.totalSleepMs += sleepMs;
+
+  ProfileHistogram& h = stats.awake;
+  h.count++;
+  h.buckets[ProfileBuckets::indexOf(awakeMs)]++;
+  if (awakeMs > h.maxValue) {
+    h.maxValue = awakeMs;
+  }
+
+  LOG_RECORD(LOG_LEVEL_INFO, LOG_SLEEP_CYCLE, awakeMs, sleepMs, deep, stats.cycles);
+}
+
+void LowPower::printReport(Print& out) {
+  // En geniş hâli: 5 sütun 10 haneli uint32 değer + 20 haneli oran + boşluklar
+  char line[96];
+  uint32_t total = stats.totalAwakeMs + stats.totalSleepMs;
+  unsigned long awakePermille = total ? (unsigned long)((uint64_t)stats.totalAwakeMs * 1000 / total) : 0;
+
+  out.println(F("Uyku   döngü  derin  p50(ms)  p99(ms)  max(ms)  uyanık"));
+  snprintf(line, sizeof(line), "%-5s %6lu %6lu %8lu %8lu %8lu  %lu.%lu%%",
+           "awake",
+           (unsigned long)stats.cycles,
+           (unsigned long)stats.deepCycles,
+           (unsigned long)ProfileBuckets::percentile(stats.awake, 50),
+           (unsigned long)ProfileBuckets::percentile(stats.awake, 99),
+           (unsigned long)stats.awake.maxValue,
+           awakePermille / 10, awakePermille % 10);
+  out.println(line);
+}
+
+void LowPower::resetStats() {
+  memset(&stats, 0, sizeof(stats));
+}
@@ -1,105 +1,264 @@
 #include "../Features/Messaging/MessageService.h"
+#include "../Features/Encoding/TextCompressor.h"
+#include "../Core/Utils/LogRing.h"
 
-// Static instance pointer for callback işlemleri
-MessageService* MessageService::messageServiceInstance = nullptr;
-
-MessageService::MessageService() : loraManager(nullptr), messagePending(false) {
-  messageServiceInstance = this;
+MessageService::MessageService() :
+  loraManager(nullptr),
+  messagePending(false),
+  pendingConfirmed(false),
+  textCompression(false) {
+  memset(&inFlight, 0, sizeof(inFlight));
 }
 
 void MessageService::setup(LoraManager* manager) {
   loraManager = manager;
   
-  // Geri çağırma işlevlerini kaydet
+  // TX sonucu ve bekleyen iletimi düşüren olaylara abone ol
   if (loraManager) {
-    loraManager->setTxCompleteCallback(onTxComplete);
-    loraManager->setEventCallback(onLoraEvent);
+    loraManager->subscribe(LORA_EVENTS_TX_DONE | LORA_EVENTS_LINK_LOST, onLoraEvent, this);
   }
   
-  Serial.println(F("Mesaj Servisi başlatıldı"));
-
-  // Kanal kısıtlamasını kaldır - Tüm kanalları kullan
-  // Artık kanal kapatma kodu yok - tüm kanallar açık kalacak
+  // Birleştirilmiş çerçeveler uplink kuyruğu üzerinden gönderilir
+  aggregator.setFlushCallback(onAggregateFlush, this);
   
-  // Her JOIN cevabı gelebilecek olan kanalları spesifik olarak etkinleştir
-  for (uint8_t i = 0; i < 9; i++) {
-    LMIC_enableChannel(i);
+  LOG_INFO(F("Mesaj Servisi başlatıldı"));
+}
+
+void MessageService::loop() {
+  // Diğer görevden postData ile gelen istekleri sıraya al
+  UplinkRequest request;
+  while (inbox.pop(request)) {
+    sendData(request.data, request.size, request.port, request.priority);
   }
   
-  Serial.println(F("JOIN için tüm kanallar etkinleştirildi (868.1, 868.3, 868.5, 867.1, 867.3, 867.5, 867.7, 867.9, 868.8 MHz)"));
+  // Birleştirme aşaması çerçeveleri geçerli veri hızının kapasitesine kadar doldurur
+  aggregator.setMaxFrameSize(getMaxPayloadSize());
+  
+  // Gecikme eşiği dolan birleştirilmiş çerçeveyi kuyruğa aktar
+  aggregator.loop();
+  
+  // Ağa katılım sonrası veya reddedilen bir gönderimden sonra kuyruğu boşalt
+  trySendNext();
 }
 
-bool MessageService::sendMessage(const char* message) {
+bool MessageService::sendMessage(const char* message, uint8_t priority, uint32_t deadlineMs) {
   if (!loraManager || !message) {
     return false;
   }
   
+  size_t textLength = strlen(message);
+  const uint8_t* payload = (const uint8_t*)message;
+  uint8_t length = textLength > 255 ? 255 : textLength;
+  
+  // Sıkıştırma etkinse ve kazanç varsa sıkıştırılmış çerçeveyi gönder
+  uint8_t maxPayload = getMaxPayloadSize();
+  uint8_t compressed[UPLINK_SLOT_SIZE];
+  if (textCompression && textLength <= 255) {
+    uint8_t compressedLength = TextCompressor::compress(message, length, compressed, sizeof(compressed));
+    if (compressedLength > 0) {
+      payload = compressed;
+      length = compressedLength;
+    }
+  }
+  
   // Mesaj uzunluğunu kontrol et
-  uint8_t length = strlen(message);
-  if (length == 0 || length > 51) { // LoRaWAN max payload boyutu için sınırlama
-    Serial.println(F("Mesaj boş veya çok uzun"));
+  if (textLength == 0 || length > maxPayload) { // Veri hızına bağlı LoRaWAN yük sınırı
+    LOG_RECORD(LOG_LEVEL_ERROR, LOG_MSG_REJECTED, 0, textLength, maxPayload);
     return false;
   }
   
-  // Zaten bekleyen bir mesaj var mı kontrol et
-  if (messagePending) {
-    Serial.println(F("Zaten bekleyen bir mesaj var, lütfen tamamlanmasını bekleyin"));
+  // Metin mesajını kuyruğa al
+  if (!queue.push(payload, length, 1, priority, deadlineMs, priority >= PRIORITY_CRITICAL)) {
+    LOG_RECORD(LOG_LEVEL_ERROR, LOG_MSG_REJECTED, 1, length, maxPayload);
     return false;
   }
   
-  // Metin mesajını gönder
-  Serial.print(F("Gönderiliyor: "));
-  Serial.println(message);
+  LOG_RECORD(LOG_LEVEL_DEBUG, LOG_MSG_QUEUED, 1, length, queue.depth());
   
-  // Metin mesajını gönderme işlemi
-  bool result = loraManager->sendData((uint8_t*)message, length, 1, true); // Onaylı mesaj
-  if (result) {
-    messagePending = true;
+  trySendNext();
+  return true;
+}
+
+bool MessageService::postData(const uint8_t* data, uint8_t size, uint8_t port, uint8_t priority) {
+  if (!data || size == 0 || size > UPLINK_SLOT_SIZE) {
+    return false;
   }
   
-  return result;
+  UplinkRequest request;
+  memcpy(request.data, data, size);
+  request.size = size;
+  request.port = port;
+  request.priority = priority;
+  return inbox.push(request);
 }
 
-bool MessageService::sendData(uint8_t* data, uint8_t size, uint8_t port) {
+bool MessageService::sendData(uint8_t* data, uint8_t size, uint8_t port, uint8_t priority, uint32_t deadlineMs) {
   if (!loraManager || !data || size == 0) {
     return false;
   }
   
-  // Zaten bekleyen bir mesaj var mı kontrol et
-  if (messagePending) {
-    Serial.println(F("Zaten bekleyen bir veri var, lütfen tamamlanmasını bekleyin"));
+  if (size > getMaxPayloadSize()) {
+    LOG_RECORD(LOG_LEVEL_ERROR, LOG_MSG_REJECTED, 2, size, getMaxPayloadSize());
+    return false;
+  }
+  
+  // Veriyi kuyruğa al
+  if (!queue.push(data, size, port, priority, deadlineMs, priority >= PRIORITY_CRITICAL)) {
+    LOG_RECORD(LOG_LEVEL_ERROR, LOG_MSG_REJECTED, 1, size, getMaxPayloadSize());
+    return false;
+  }
+  
+  LOG_RECORD(LOG_LEVEL_DEBUG, LOG_MSG_QUEUED, port, size, queue.depth());
+  
+  trySendNext();
+  return true;
+}
+
+uint8_t MessageService::getMaxPayloadSize() const {
+  if (!loraManager) {
+    return Region::minPayload();
+  }
+  return loraManager->getMaxPayloadSize();
+}
+
+uint32_t MessageService::nextSendTime() const {
+  if (!loraManager) {
+    return Utils::getTimestamp();
+  }
+  return loraManager->getDutyCycleLedger().nextSendTime();
+}
+
+bool MessageService::addRecord(uint8_t type, const uint8_t* data, uint8_t length) {
+  return aggregator.addRecord(type, data, length);
+}
+
+bool MessageService::isIdle() const {
+  return !messagePending && queue.isEmpty() && inbox.isEmpty() && aggregator.pendingRecords() == 0;
+}
+
+UplinkAggregator& MessageService::getAggregator() {
+  return aggregator;
+}
+
+bool MessageService::onAggregateFlush(void* context, uint8_t* frame, uint8_t size) {
+  MessageService* service = static_cast<MessageService*>(context);
+  return service->sendData(frame, size, AGGREGATE_PORT);
+}
+
+void MessageService::setTextCompression(bool enabled) {
+  textCompression = enabled;
+}
+
+const ConfirmPolicyStats& MessageService::getConfirmStats() const {
+  return confirmPolicy.getStats();
+}
+
+void MessageService::setDropPolicy(DropPolicy policy) {
+  queue.setDropPolicy(policy);
+}
+
+const UplinkQueueStats& MessageService::getQueueStats() const {
+  return queue.getStats();
+}
+
+bool MessageService::trySendNext() {
+  // LMIC'te bekleyen iletim varsa veya ağa bağlı değilsek sonraki fırsatı bekle
+  if (!loraManager || messagePending || !loraManager->isJoined()) {
+    return false;
+  }
+  if (loraManager->getLMIC()->opmode & OP_TXRXPEND) {
+    return false;
+  }
+  
+  // Alt bantlar görev döngüsü nedeniyle kapalıysa LMIC içinde beklemek yerine
+  // mesajı kuyrukta tut; loop() en erken yasal zamanda tekrar dener
+  if (!loraManager->getDutyCycleLedger().canSendNow()) {
     return false;
   }
   
-  // Veriyi gönder
-  Serial.print(F("Veri gönderiliyor, boyut: "));
-  Serial.println(size);
+  const UplinkMessage* next = queue.peek();
+  if (!next) {
+    return false;
+  }
+  
+  // Kuyruğa alındıktan sonra veri hızı düştüyse mesaj artık sığmaz
+  if (next->size > getMaxPayloadSize()) {
+    LOG_RECORD(LOG_LEVEL_ERROR, LOG_MSG_REJECTED, 3, next->size, getMaxPayloadSize());
+    queue.discard();
+    return false;
+  }
+  
+  // Varsayılan onaysız; her N. çerçevede veya kritik mesajda ACK iste
+  bool confirmed = confirmPolicy.shouldConfirm(next->critical);
   
-  bool result = loraManager->sendData(data, size, port, true); // Onaylı mesaj
-  if (result) {
-    messagePending = true;
+  // LMIC_setTxData2 veriyi kendi tamponuna kopyalar, mesaj hemen kuyruktan çıkarılabilir
+  if (!loraManager->sendData((uint8_t*)next->data, next->size, next->port, confirmed)) {
+    return false;
   }
   
-  return result;
+  // Boş ACK downlink'i (MHDR + FHDR + MIC, RX1 DR ofseti 0) yaklaşık olarak
+  // yüksüz bir uplink çerçevesi kadar yayın süresi harcar
+  dr_t datarate = loraManager->getLMIC()->datarate;
+  uint32_t airtime = DutyCycleLedger::uplinkAirtimeMs(datarate, next->size);
+  uint32_t ackAirtime = DutyCycleLedger::uplinkAirtimeMs(datarate, 0);
+  confirmPolicy.onSent(confirmed, airtime, ackAirtime);
+  
+  inFlight = *next;
+  queue.pop();
+  messagePending = true;
+  pendingConfirmed = confirmed;
+  return true;
 }
 
-void MessageService::onTxComplete(bool success) {
-  if (messageServiceInstance == nullptr) return;
+void MessageService::onTxComplete(const LoraEvent& event) {
+  bool success = event.success;
+  LOG_RECORD(success ? LOG_LEVEL_INFO : LOG_LEVEL_ERROR, LOG_MSG_TX_RESULT, success);
   
-  if (success) {
-    Serial.println(F("Mesaj başarıyla gönderildi"));
-  } else {
-    Serial.println(F("Mesaj gönderimi başarısız"));
+  // Onaylı çerçevenin ACK sonucu politikayı uyarlar
+  if (pendingConfirmed) {
+    confirmPolicy.onConfirmedResult(success && (event.txrxFlags & TXRX_ACK));
   }
   
-  messageServiceInstance->messagePending = false;
+  messagePending = false;
+  pendingConfirmed = false;
+  
+  // Kuyrukta bekleyen sıradaki mesajı gönder
+  trySendNext();
+}
+
+void MessageService::onLinkLost(const LoraEvent& event) {
+  if (!messagePending) {
+    return;
+  }
+  
+  // LMIC sıfırlandı; TXCOMPLETE/TXCANCELED hiç gelmeyecek. Bayrak kalırsa
+  // yeniden join sonrası kuyruk sonsuza dek bekler
+  LOG_RECORD(LOG_LEVEL_ERROR, LOG_MSG_TX_RESULT, false, event.ev);
+  messagePending = false;
+  pendingConfirmed = false;
+  
+  // Çerçeve havaya çıkmış olabilir ama sonucu bilinmiyor: yeniden join
+  // sonrası tekrar gönderilmek üzere başa koy (en az bir kez teslim)
+  if (!queue.requeue(inFlight)) {
+    LOG_RECORD(LOG_LEVEL_ERROR, LOG_MSG_REJECTED, 1, inFlight.size, getMaxPayloadSize());
+  }
 }
 
-void MessageService::onLoraEvent(ev_t event) {
-  // Gelecekteki genişletmeler için LoRa olaylarını işleyin
-  // Örneğin, ağdan gelen mesajları işleme
-  if (event == EV_TXCOMPLETE && LMIC.dataLen > 0) {
-    Serial.println(F("Downlink verisi alındı"));
-    // Downlink verilerini işleme kodu buraya eklenebilir
+void MessageService::onLoraEvent(void* context, const LoraEvent& event) {
+  MessageService* self = static_cast<MessageService*>(context);
+  switch (event.ev) {
+    case EV_TXCOMPLETE:
+    case EV_TXCANCELED:
+      self->onTxComplete(event);
+      break;
+    case EV_RESET:
+    case EV_LINK_DEAD:
+    case EV_JOINING:
+      self->onLinkLost(event);
+      break;
+    default:
+      break;
   }
-} 
\ No newline at end of file
+  
+  // Downlink yükleri LoraManager::setDownlinkHandler (DownlinkDispatcher) ile işlenir
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+#include "../Core/Utils/Profiler.h"
+
+ProfileHistogram Profiler::histograms[PROF_SCOPE_COUNT];
+
+void Profiler::record(uint8_t scope, uint32_t cycles) {
+  if (scope >= PROF_SCOPE_COUNT) {
+    return;
+  }
+
+  ProfileHistogram& h = histograms[scope];
+  h.count++;
+  h.buckets[ProfileBuckets::indexOf(cycles)]++;
+  if (cycles > h.maxValue) {
+    h.maxValue = cycles;
+  }
+}
+
+uint32_t Profiler::cyclesToUs(uint32_t cycles) {
+#if defined(ESP32)
+  return cycles / ESP.getCpuFreqMHz();
+#else
+  return cycles;
+#endif
+}
+
+void Profiler::printReport(Print& out) {
+#if PROFILER_ENABLED
+  char line[72];
+  out.println(F("Kapsam       adet      p50(us)  p99(us)  max(us)"));
+  for (uint8_t i = 0; i < PROF_SCOPE_COUNT; i++) {
+    const ProfileHistogram& h = histograms[i];
+    snprintf(line, sizeof(line), "%-10s %8lu %8lu %8lu %8lu",
+             kProfileScopeNames[i],
+             (unsigned long)h.count,
+             (unsigned long)cyclesToUs(ProfileBuckets::percentile(h, 50)),
+             (unsigned long)cyclesToUs(ProfileBuckets::percentile(h, 99)),
+             (unsigned long)cyclesToUs(h.maxValue));
+    out.println(line);
+  }
+#else
+  out.println(F("Profiler kapalı (PROFILER_ENABLED 0)"));
+#endif
+}
+
+void Profiler::dump(Print& out) {
+  ProfileDumpHeader header;
+  header.magic = PROFILE_DUMP_MAGIC;
+  header.version = PROFILE_DUMP_VERSION;
+  header.scopeCount = PROF_SCOPE_COUNT;
+  header.bucketCount = PROFILE_BUCKETS;
+#if defined(ESP32)
+  header.cpuMhz = ESP.getCpuFreqMHz();
+#else
+  header.cpuMhz = 1;
+#endif
+  header.uptimeMs = Utils::getTimestamp();
+
+  out.write((const uint8_t*)&header, sizeof(header));
+  out.write((const uint8_t*)histograms, sizeof(histograms));
+}
+
+void Profiler::reset() {
+  memset(histograms, 0, sizeof(histograms));
+}
+
+const ProfileHistogram& Profiler::getHistogram(uint8_t scope) {
+  return histograms[scope < PROF_SCOPE_COUNT ? scope : (uint8_t)PROF_LOOP];
+}
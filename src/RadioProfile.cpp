@@ -0,0 +1,131 @@
+#include "../Core/Lora/RadioProfile.h"
+#include "../Core/Lora/RegionPlan.h"
+#include "../Core/Utils/LogRing.h"
+
+const uint8_t RadioProfile::kPolicy[RADIO_PARAM_COUNT] = {
+  RADIO_POLICY_RX_DELAY,
+  RADIO_POLICY_RX1_DR_OFFSET,
+  RADIO_POLICY_RX2_DR,
+  RADIO_POLICY_RX2_FREQ,
+  RADIO_POLICY_DATARATE,
+  RADIO_POLICY_TX_POWER,
+};
+
+static const char* const kParamNames[RADIO_PARAM_COUNT] = {
+  "rxDelay", "rx1DrOff", "rx2Dr", "rx2Freq", "dr", "txPow"
+};
+
+RadioProfile::RadioProfile() {
+  targets[RADIO_PARAM_RX_DELAY] = RADIO_PROFILE_RX_DELAY;
+  targets[RADIO_PARAM_RX1_DR_OFFSET] = RADIO_PROFILE_RX1_DR_OFFSET;
+  targets[RADIO_PARAM_RX2_DR] = RADIO_PROFILE_RX2_DR;
+  targets[RADIO_PARAM_RX2_FREQ] = Region::current().rx2Frequency;
+  targets[RADIO_PARAM_DATARATE] = RADIO_PROFILE_DATARATE;
+  targets[RADIO_PARAM_TX_POWER] = RADIO_PROFILE_TX_POWER;
+  memset(applied, 0, sizeof(applied));
+  memset(&stats, 0, sizeof(stats));
+}
+
+void RadioProfile::applyReset() {
+  for (uint8_t p = 0; p < RADIO_PARAM_COUNT; p++) {
+    write((RadioParam)p, targets[p]);
+  }
+  snapshot();
+}
+
+void RadioProfile::applyJoined() {
+  for (uint8_t p = 0; p < RADIO_PARAM_COUNT; p++) {
+    if (kPolicy[p] == RADIO_POLICY_PROFILE) {
+      write((RadioParam)p, targets[p]);
+    }
+  }
+  snapshot();
+}
+
+bool RadioProfile::checkDrift() {
+  bool serverChanged = false;
+  stats.checks++;
+
+  for (uint8_t p = 0; p < RADIO_PARAM_COUNT; p++) {
+    int32_t current = read((RadioParam)p);
+    if (current == applied[p]) {
+      continue;
+    }
+
+    bool accept = kPolicy[p] == RADIO_POLICY_SERVER;
+    LOG_RECORD(LOG_LEVEL_INFO, LOG_RADIO_DRIFT, p, current, applied[p], accept);
+    if (accept) {
+      applied[p] = current;
+      stats.accepted[p]++;
+      serverChanged = true;
+    } else {
+      write((RadioParam)p, applied[p]);
+      stats.reverted[p]++;
+    }
+  }
+
+  return serverChanged;
+}
+
+void RadioProfile::set(RadioParam param, int32_t value) {
+  if (param >= RADIO_PARAM_COUNT) {
+    return;
+  }
+  targets[param] = value;
+  write(param, value);
+  applied[param] = read(param);
+}
+
+int32_t RadioProfile::target(RadioParam param) const {
+  return param < RADIO_PARAM_COUNT ? targets[param] : 0;
+}
+
+const RadioProfileStats& RadioProfile::getStats() const {
+  return stats;
+}
+
+void RadioProfile::printReport(Print& out) const {
+  char line[72];
+  out.println(F("Profil    hedef      LMIC  kazanan  kabul  geri"));
+  for (uint8_t p = 0; p < RADIO_PARAM_COUNT; p++) {
+    snprintf(line, sizeof(line), "%-8s %9ld %9ld  %-7s %5lu %5lu",
+             kParamNames[p],
+             (long)targets[p],
+             (long)read((RadioParam)p),
+             kPolicy[p] == RADIO_POLICY_SERVER ? "sunucu" : "profil",
+             (unsigned long)stats.accepted[p],
+             (unsigned long)stats.reverted[p]);
+    out.println(line);
+  }
+}
+
+int32_t RadioProfile::read(RadioParam param) {
+  switch (param) {
+    case RADIO_PARAM_RX_DELAY:      return LMIC.rxDelay;
+    case RADIO_PARAM_RX1_DR_OFFSET: return LMIC.rx1DrOffset;
+    case RADIO_PARAM_RX2_DR:        return LMIC.dn2Dr;
+    case RADIO_PARAM_RX2_FREQ:      return (int32_t)LMIC.dn2Freq;
+    case RADIO_PARAM_DATARATE:      return LMIC.datarate;
+    case RADIO_PARAM_TX_POWER:      return LMIC.adrTxPow;
+    default:                        return 0;
+  }
+}
+
+void RadioProfile::write(RadioParam param, int32_t value) {
+  switch (param) {
+    case RADIO_PARAM_RX_DELAY:      LMIC.rxDelay = value; break;
+    case RADIO_PARAM_RX1_DR_OFFSET: LMIC.rx1DrOffset = value; break;
+    case RADIO_PARAM_RX2_DR:        LMIC.dn2Dr = value; break;
+    case RADIO_PARAM_RX2_FREQ:      LMIC.dn2Freq = (uint32_t)value; break;
+    // Veri hızı ve güç LMIC'te birlikte ayarlanır
+    case RADIO_PARAM_DATARATE:      LMIC_setDrTxpow(value, LMIC.adrTxPow); break;
+    case RADIO_PARAM_TX_POWER:      LMIC_setDrTxpow(LMIC.datarate, value); break;
+    default:                        break;
+  }
+}
+
+void RadioProfile::snapshot() {
+  for (uint8_t p = 0; p < RADIO_PARAM_COUNT; p++) {
+    applied[p] = read((RadioParam)p);
+  }
+}
@@ -0,0 +1,79 @@
+#include "../Core/Lora/RadioTask.h"
+
+LoraManager* RadioTask::manager = nullptr;
+RadioServiceHook RadioTask::hook = nullptr;
+void* RadioTask::hookContext = nullptr;
+
+#if defined(ESP32)
+TaskHandle_t RadioTask::handle = nullptr;
+#else
+std::thread RadioTask::thread;
+std::atomic<bool> RadioTask::stopRequested(false);
+#endif
+
+bool RadioTask::start(LoraManager* loraManager, RadioServiceHook serviceHook, void* context) {
+  if (!loraManager || isRunning()) {
+    return false;
+  }
+
+  manager = loraManager;
+  hook = serviceHook;
+  hookContext = context;
+
+#if defined(ESP32)
+  BaseType_t created = xTaskCreatePinnedToCore(run, "radio", RADIO_TASK_STACK, nullptr,
+                                               RADIO_TASK_PRIORITY, &handle, RADIO_TASK_CORE);
+  if (created != pdPASS) {
+    handle = nullptr;
+    LOG_ERROR(F("Radyo görevi oluşturulamadı"));
+    return false;
+  }
+#else
+  stopRequested = false;
+  thread = std::thread(run, nullptr);
+#endif
+
+  LOG_INFO(F("Radyo görevi başlatıldı, çekirdek: "), RADIO_TASK_CORE);
+  return true;
+}
+
+bool RadioTask::isRunning() {
+#if defined(ESP32)
+  return handle != nullptr;
+#else
+  return thread.joinable();
+#endif
+}
+
+#if !defined(ESP32)
+void RadioTask::stop() {
+  if (!thread.joinable()) {
+    return;
+  }
+  stopRequested = true;
+  thread.join();
+}
+#endif
+
+void RadioTask::run(void* parameter) {
+  (void)parameter;
+
+#if defined(ESP32)
+  for (;;) {
+#else
+  while (!stopRequested) {
+#endif
+    manager->loop();
+    if (hook) {
+      hook(hookContext);
+    }
+
+    // LMIC işleri os_getTime'a göre zamanlanır; 1 ms'lik uyku RX açılışını
+    // geciktirmez ve düşük öncelikli görevlerin (IDLE, watchdog) çalışmasını sağlar
+#if defined(ESP32)
+    vTaskDelay(1);
+#else
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+#endif
+  }
+}
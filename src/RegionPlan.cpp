@@ -0,0 +1,60 @@
+#include "../Core/Lora/RegionPlan.h"
+#include <lmic.h>
+#include "../Core/Utils/LogRing.h"
+
+namespace Region {
+
+bool apply() {
+  const RegionPlan& plan = current();
+
+#if defined(CFG_us915)
+  // Sabit kanal tablosu: yalnızca plandaki kanallar açık kalır
+  for (uint8_t ch = 0; ch < plan.channelSlots; ch++) {
+    LMIC_disableChannel(ch);
+  }
+  for (uint8_t i = 0; i < plan.channelCount; i++) {
+    LMIC_enableChannel(plan.channels[i].index);
+  }
+#else
+  for (uint8_t i = 0; i < plan.channelCount; i++) {
+    const RegionChannel& c = plan.channels[i];
+    // Varsayılan kanallar LMIC_reset'te kurulur ve LMIC_setupChannel ile
+    // değiştirilemez; yalnızca etkinleştirilir, uyumu validate() denetler.
+    // Bant parametresini yalnızca EU868 kullanır, diğer bölgeler yok sayar
+    if (c.index >= plan.defaultChannels) {
+      LMIC_setupChannel(c.index, c.frequency, DR_RANGE_MAP(c.minDr, c.maxDr), c.band);
+    }
+    LMIC_enableChannel(c.index);
+  }
+#endif
+
+  return validate();
+}
+
+bool validate() {
+  const RegionPlan& plan = current();
+  bool valid = true;
+
+  for (uint8_t i = 0; i < plan.channelCount; i++) {
+    const RegionChannel& c = plan.channels[i];
+#if defined(CFG_us915)
+    // Frekanslar LMIC'te kanal numarasından hesaplanır; yalnızca maske denetlenir
+    uint32_t frequency = c.frequency;
+    bool drMatches = true;
+    bool enabled = (LMIC.channelMap[c.index >> 4] & (1 << (c.index & 0xF))) != 0;
+#else
+    // EU868'de frekansın düşük iki biti bant indeksini tutar
+    uint32_t frequency = LMIC.channelFreq[c.index] & ~(uint32_t)3;
+    bool drMatches = LMIC.channelDrMap[c.index] == DR_RANGE_MAP(c.minDr, c.maxDr);
+    bool enabled = (LMIC.channelMap & (1 << c.index)) != 0;
+#endif
+    if (frequency != c.frequency || !drMatches || !enabled) {
+      LOG_RECORD(LOG_LEVEL_ERROR, LOG_REGION_MISMATCH, c.index, c.frequency, frequency, enabled);
+      valid = false;
+    }
+  }
+
+  return valid;
+}
+
+} // namespace Region
@@ -0,0 +1,182 @@
+#include "../Core/Lora/RxCalibration.h"
+#include "../Core/Utils/LogRing.h"
+
+// Kalibre edilmemiş durumda kullanılan geniş saat hatası
+static const uint32_t kDefaultClockError = (uint32_t)MAX_CLOCK_ERROR * CLOCK_ERROR_PERCENTAGE / 100;
+
+RxCalibration::RxCalibration() {
+  memset(&stats, 0, sizeof(stats));
+  windowCount = 0;
+  joinUplink = false;
+  rx1DelayMs = 1000;
+  reset();
+}
+
+void RxCalibration::reset() {
+  calibrationSamples = 0;
+  consecutiveMisses = 0;
+  peakPpm = 0;
+  stats.calibrated = false;
+  stats.clockErrorPpm = (uint32_t)((uint64_t)kDefaultClockError * 1000000 / MAX_CLOCK_ERROR);
+}
+
+void RxCalibration::onTxStart(bool joining) {
+  joinUplink = joining;
+  // RxDelay 0, LoRaWAN'da 1 saniye demektir
+  uint8_t delaySeconds = joining ? LORAWAN_JOIN_ACCEPT_DELAY1 : (LMIC.rxDelay ? LMIC.rxDelay : 1);
+  rx1DelayMs = delaySeconds * 1000UL;
+  windowCount = 0;
+}
+
+void RxCalibration::onRxStart() {
+  if (windowCount >= RX_CAL_MAX_WINDOWS) {
+    return;
+  }
+
+  RxWindow& window = windows[windowCount++];
+  window.start = os_getTime();
+  window.rps = LMIC.rps;
+  if (getSf(window.rps) == FSK) {
+    window.timeoutUs = 0;
+    return;
+  }
+  LoraTxParams p = downlinkParams(window.rps);
+  uint32_t symbolUs = (uint32_t)(((uint64_t)1 << p.spreadingFactor) * 1000000ULL / p.bandwidthHz);
+  window.timeoutUs = LMIC.rxsyms * symbolUs;
+}
+
+void RxCalibration::onUplinkDone(bool received, bool missed) {
+  if (windowCount == 0) {
+    return;
+  }
+
+  // Alınmayan pencereler sembol zaman aşımı kadar açık kalır
+  uint32_t onUs = 0;
+  for (uint8_t i = 0; i < windowCount; i++) {
+    onUs += windows[i].timeoutUs;
+  }
+
+  const RxWindow& last = windows[windowCount - 1];
+  if (received && getSf(last.rps) != FSK) {
+    // LMIC.rxtime alımdan sonra RxDone anını (IRQ gecikmesi düzeltilmiş) tutar
+    ostime_t rxDone = LMIC.rxtime;
+    uint32_t airUs = Airtime::timeOnAirUs(downlinkParams(last.rps), receivedFrameLength());
+
+    int32_t listenedUs = osticks2us(rxDone - last.start);
+    onUs = onUs - last.timeoutUs + (listenedUs > 0 ? listenedUs : 0);
+
+    // Önsözün gerçek başlangıcı TX bitişine göre; RX2, RX1'den 1 sn sonradır
+    int32_t sinceTxUs = osticks2us(rxDone - LMIC.txend) - (int32_t)airUs;
+    uint32_t expectedUs = rx1DelayMs * 1000UL;
+    if (sinceTxUs > (int32_t)(expectedUs + 500000UL)) {
+      expectedUs += 1000000UL;
+    }
+    addSample(sinceTxUs - (int32_t)expectedUs, expectedUs / 1000);
+  } else if (missed) {
+    stats.misses++;
+    consecutiveMisses++;
+    // Pencere fazla daraltılmış olabilir: geniş ayara dön ve yeniden ölç
+    if (stats.calibrated && consecutiveMisses >= RX_CAL_MAX_MISSES) {
+      reset();
+    }
+  }
+
+  stats.uplinks++;
+  stats.lastRxOnUs = onUs;
+  stats.meanRxOnUs = stats.uplinks == 1 ? onUs :
+                     (uint32_t)((int32_t)stats.meanRxOnUs + ((int32_t)onUs - (int32_t)stats.meanRxOnUs) / 4);
+  windowCount = 0;
+
+  LOG_RECORD(LOG_LEVEL_INFO, LOG_RX_CALIBRATION, stats.lastOffsetUs, stats.clockErrorPpm, onUs, received);
+
+  apply();
+}
+
+void RxCalibration::addSample(int32_t offsetUs, uint32_t delayMs) {
+  uint32_t absUs = offsetUs < 0 ? -offsetUs : offsetUs;
+
+  stats.samples++;
+  stats.lastOffsetUs = offsetUs;
+  stats.meanAbsOffsetUs = stats.samples == 1 ? absUs :
+                          (uint32_t)((int32_t)stats.meanAbsOffsetUs + ((int32_t)absUs - (int32_t)stats.meanAbsOffsetUs) / 4);
+  if (absUs > stats.maxAbsOffsetUs) {
+    stats.maxAbsOffsetUs = absUs;
+  }
+  consecutiveMisses = 0;
+
+  // Sapmanın gecikmeye oranı (ppm); tepe değeri yavaşça unutulur, tek bir
+  // iyi ölçüm pencereyi birden daraltmaz
+  uint32_t samplePpm = (uint32_t)((uint64_t)absUs * 1000 / delayMs);
+  peakPpm -= peakPpm / 8;
+  if (samplePpm > peakPpm) {
+    peakPpm = samplePpm;
+  }
+
+  if (calibrationSamples < 255) {
+    calibrationSamples++;
+  }
+  if (RX_CALIBRATION && calibrationSamples >= RX_CAL_MIN_SAMPLES) {
+    uint32_t ppm = peakPpm * RX_CAL_MARGIN;
+    if (ppm < RX_CAL_MIN_ERROR_PPM) {
+      ppm = RX_CAL_MIN_ERROR_PPM;
+    }
+    stats.calibrated = true;
+    stats.clockErrorPpm = ppm;
+  }
+}
+
+uint16_t RxCalibration::clockError() const {
+  if (!stats.calibrated) {
+    return kDefaultClockError;
+  }
+  uint32_t value = (uint32_t)(((uint64_t)stats.clockErrorPpm * MAX_CLOCK_ERROR + 999999) / 1000000);
+  return value < kDefaultClockError ? value : kDefaultClockError;
+}
+
+void RxCalibration::apply() const {
+  LMIC_setClockError(clockError());
+}
+
+const RxCalibrationStats& RxCalibration::getStats() const {
+  return stats;
+}
+
+void RxCalibration::printReport(Print& out) const {
+  // En geniş hâli: 7 sütun 10-11 haneli (işaretli) değer + "geniş" (6 byte) + boşluklar
+  char line[96];
+  out.println(F("RX     örnek kaçan  sapma(us) ort(us) max(us)   ppm  rxOn(us)"));
+  snprintf(line, sizeof(line), "%-5s %6lu %5lu %10ld %7lu %7lu %5lu %9lu",
+           stats.calibrated ? "kalib" : "geniş",
+           (unsigned long)stats.samples,
+           (unsigned long)stats.misses,
+           (long)stats.lastOffsetUs,
+           (unsigned long)stats.meanAbsOffsetUs,
+           (unsigned long)stats.maxAbsOffsetUs,
+           (unsigned long)stats.clockErrorPpm,
+           (unsigned long)stats.meanRxOnUs);
+  out.println(line);
+}
+
+uint8_t RxCalibration::receivedFrameLength() const {
+  if (joinUplink) {
+    // Join-accept: MHDR + 12 byte alan + MIC; EU benzeri bölgelerde CFList (+16) ile
+#if CFG_LMIC_EU_like
+    return 33;
+#else
+    return 17;
+#endif
+  }
+  // Veri çerçevesi: başlık ve FPort dataBeg'e kadar, ardından yük ve MIC
+  return LMIC.dataBeg + LMIC.dataLen + 4;
+}
+
+LoraTxParams RxCalibration::downlinkParams(rps_t rps) {
+  LoraTxParams p;
+  p.spreadingFactor = getSf(rps) - SF7 + 7;
+  p.bandwidthHz = 125000UL << getBw(rps);
+  p.codingRate = getCr(rps) - CR_4_5 + 1;
+  p.preambleSymbols = 8;
+  p.explicitHeader = true;
+  p.crc = false;           // LoRaWAN downlink'lerinde PHY CRC yok
+  return p;
+}
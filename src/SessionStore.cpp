@@ -0,0 +1,180 @@
+#include "../Core/Lora/SessionStore.h"
+#include "../Core/Utils/Log.h"
+
+#if !defined(ESP32)
+#include <stdio.h>
+#endif
+
+static const char* const kSessionKey = "session";
+static const char* const kCountersKey = "fcnt";
+
+SessionStore::SessionStore() :
+  opened(false),
+  writes(0) {
+}
+
+bool SessionStore::begin() {
+#if defined(ESP32)
+  opened = prefs.begin(SESSION_STORE_NAMESPACE, false);
+  if (!opened) {
+    LOG_ERROR(F("Oturum deposu (NVS) açılamadı"));
+  }
+#else
+  opened = true;
+#endif
+  return opened;
+}
+
+bool SessionStore::loadSession(LoraSession& session) {
+  if (!read(kSessionKey, &session, sizeof(session))) {
+    return false;
+  }
+  return session.magic == SESSION_MAGIC && session.version == SESSION_VERSION &&
+         session.checksum == checksum(&session, offsetof(LoraSession, checksum));
+}
+
+bool SessionStore::saveSession(LoraSession& session) {
+  session.checksum = checksum(&session, offsetof(LoraSession, checksum));
+  return write(kSessionKey, &session, sizeof(session));
+}
+
+bool SessionStore::loadCounters(LoraSessionCounters& counters) {
+  if (!read(kCountersKey, &counters, sizeof(counters))) {
+    return false;
+  }
+  return counters.magic == SESSION_MAGIC &&
+         counters.checksum == checksum(&counters, offsetof(LoraSessionCounters, checksum));
+}
+
+bool SessionStore::saveCounters(LoraSessionCounters& counters) {
+  counters.magic = SESSION_MAGIC;
+  counters.reserved = 0;
+  counters.checksum = checksum(&counters, offsetof(LoraSessionCounters, checksum));
+  return write(kCountersKey, &counters, sizeof(counters));
+}
+
+void SessionStore::clearSession() {
+  remove(kSessionKey);
+}
+
+void SessionStore::capture(LoraSession& session) {
+  // Hizalama boşlukları da sağlama toplamına girer; önce sıfırlanmalı
+  memset(&session, 0, sizeof(session));
+  session.magic = SESSION_MAGIC;
+  session.version = SESSION_VERSION;
+
+  LMIC_getSessionKeys(&session.netId, &session.devAddr, session.nwkSKey, session.appSKey);
+  session.datarate = LMIC.datarate;
+  session.txPower = LMIC.adrTxPow;
+  session.adrEnabled = LMIC.adrEnabled;
+  session.dn2Freq = LMIC.dn2Freq;
+  session.dn2Dr = LMIC.dn2Dr;
+  session.rx1DrOffset = LMIC.rx1DrOffset;
+  session.rxDelay = LMIC.rxDelay;
+#if CFG_LMIC_EU_like
+  for (uint8_t ch = 0; ch < MAX_CHANNELS; ch++) {
+    session.channelFreq[ch] = LMIC.channelFreq[ch];
+    session.channelDrMap[ch] = LMIC.channelDrMap[ch];
+  }
+#endif
+  memcpy(session.channelMap, &LMIC.channelMap, sizeof(session.channelMap));
+}
+
+void SessionStore::restore(const LoraSession& session) {
+  // LMIC_setSession varsayılan kanalları ve sayaçları sıfırlar (stateJustJoined);
+  // ağın verdiği kanal/ADR durumu bundan sonra üzerine yazılır
+  LMIC_setSession(session.netId, session.devAddr,
+                  (xref2u1_t)session.nwkSKey, (xref2u1_t)session.appSKey);
+#if CFG_LMIC_EU_like
+  for (uint8_t ch = 0; ch < MAX_CHANNELS; ch++) {
+    LMIC.channelFreq[ch] = session.channelFreq[ch];
+    LMIC.channelDrMap[ch] = session.channelDrMap[ch];
+  }
+#endif
+  memcpy(&LMIC.channelMap, session.channelMap, sizeof(session.channelMap));
+  LMIC_setAdrMode(session.adrEnabled);
+  LMIC_setDrTxpow(session.datarate, session.txPower);
+  LMIC.dn2Freq = session.dn2Freq;
+  LMIC.dn2Dr = session.dn2Dr;
+  LMIC.rx1DrOffset = session.rx1DrOffset;
+  LMIC.rxDelay = session.rxDelay;
+}
+
+uint32_t SessionStore::getWrites() const {
+  return writes;
+}
+
+#if defined(ESP32)
+
+bool SessionStore::read(const char* key, void* data, size_t size) {
+  return opened && prefs.getBytesLength(key) == size && prefs.getBytes(key, data, size) == size;
+}
+
+bool SessionStore::write(const char* key, const void* data, size_t size) {
+  if (!opened) {
+    return false;
+  }
+  writes++;
+  return prefs.putBytes(key, data, size) == size;
+}
+
+void SessionStore::remove(const char* key) {
+  if (opened && prefs.isKey(key)) {
+    prefs.remove(key);
+  }
+}
+
+#else
+
+// Host derlemesi: her anahtar ayrı dosya; yazma geçici dosya + rename ile
+// yapılır, yarıda kesilen yazma eski kaydı bozmaz
+static void sessionFilePath(char* path, size_t size, const char* key, const char* suffix) {
+  snprintf(path, size, "%s.%s%s", SESSION_STORE_PATH, key, suffix);
+}
+
+bool SessionStore::read(const char* key, void* data, size_t size) {
+  char path[128];
+  sessionFilePath(path, sizeof(path), key, "");
+  FILE* file = fopen(path, "rb");
+  if (!file) {
+    return false;
+  }
+  bool ok = fread(data, 1, size, file) == size && fgetc(file) == EOF;
+  fclose(file);
+  return ok;
+}
+
+bool SessionStore::write(const char* key, const void* data, size_t size) {
+  char path[128];
+  char tmpPath[132];
+  sessionFilePath(path, sizeof(path), key, "");
+  sessionFilePath(tmpPath, sizeof(tmpPath), key, ".tmp");
+
+  FILE* file = fopen(tmpPath, "wb");
+  if (!file) {
+    return false;
+  }
+  bool ok = fwrite(data, 1, size, file) == size;
+  ok = (fclose(file) == 0) && ok;
+  writes++;
+  return ok && rename(tmpPath, path) == 0;
+}
+
+void SessionStore::remove(const char* key) {
+  char path[128];
+  sessionFilePath(path, sizeof(path), key, "");
+  ::remove(path);
+}
+
+#endif
+
+uint32_t SessionStore::checksum(const void* data, size_t size) {
+  // FNV-1a; bozulmuş/yarım kaydı ayırt etmek için yeterli
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= bytes[i];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
@@ -0,0 +1,165 @@
+#include "../Features/Messaging/UplinkAggregator.h"
+
+UplinkAggregator::UplinkAggregator() :
+  frameSize(AGGREGATE_HEADER_SIZE),
+  recordCount(0),
+  maxFrameSize(Region::minPayload()),
+  sizeThreshold(UPLINK_SLOT_SIZE),
+  latencyMs(AGGREGATE_LATENCY_MS),
+  firstRecordTime(0),
+  flushCallback(nullptr),
+  flushContext(nullptr),
+  totalRecords(0),
+  totalFrames(0),
+  droppedRecords(0) {
+  reset();
+}
+
+void UplinkAggregator::setFlushCallback(AggregateFlushCallback callback, void* context) {
+  flushCallback = callback;
+  flushContext = context;
+}
+
+void UplinkAggregator::setMaxFrameSize(uint8_t size) {
+  if (size > UPLINK_SLOT_SIZE) {
+    size = UPLINK_SLOT_SIZE;
+  }
+  maxFrameSize = size;
+  
+  // Veri hızı düştüyse mevcut çerçeve yeni sınırı aşabilir; flush kayıtları
+  // sığan çerçevelere böler
+  if (frameSize > maxFrameSize) {
+    flush();
+  }
+}
+
+void UplinkAggregator::setThresholds(uint8_t size, uint32_t latency) {
+  sizeThreshold = size;
+  latencyMs = latency;
+}
+
+bool UplinkAggregator::addRecord(uint8_t type, const uint8_t* data, uint8_t length) {
+  uint16_t recordSize = AGGREGATE_RECORD_HEADER + length;
+  if ((!data && length > 0) || AGGREGATE_HEADER_SIZE + recordSize > maxFrameSize) {
+    return false; // Tek başına bile çerçeveye sığmaz
+  }
+  
+  // Kayıt sığmıyorsa önce mevcut çerçeveyi gönder
+  if (frameSize + recordSize > maxFrameSize) {
+    if (!flush()) {
+      return false;
+    }
+  }
+  
+  if (recordCount == 0) {
+    firstRecordTime = Utils::getTimestamp();
+  }
+  
+  frame[frameSize++] = type;
+  frame[frameSize++] = length;
+  if (length > 0) {
+    memcpy(frame + frameSize, data, length);
+    frameSize += length;
+  }
+  recordCount++;
+  totalRecords++;
+  
+  // Boyut eşiğine ulaşıldıysa gönder
+  if (frameSize >= sizeThreshold || frameSize >= maxFrameSize) {
+    flush();
+  }
+  
+  return true;
+}
+
+void UplinkAggregator::loop() {
+  if (recordCount > 0 && (Utils::getTimestamp() - firstRecordTime) >= latencyMs) {
+    flush();
+  }
+}
+
+bool UplinkAggregator::flush() {
+  if (recordCount == 0) {
+    return true;
+  }
+  if (!flushCallback) {
+    return false;
+  }
+  
+  // Sınır kayıtlar eklendikten sonra küçüldüyse tek başına bile sığmayan
+  // kayıtlar hiçbir zaman gönderilemez
+  dropOversizeRecords();
+  
+  // Baştan sığan kayıtlar ayrı çerçeveler olarak gönderilir, kalanlar öne kaydırılır
+  while (recordCount > 0) {
+    uint8_t end = AGGREGATE_HEADER_SIZE;
+    uint8_t count = 0;
+    while (count < recordCount) {
+      uint8_t next = end + AGGREGATE_RECORD_HEADER + frame[end + 1];
+      if (next > maxFrameSize) {
+        break;
+      }
+      end = next;
+      count++;
+    }
+    
+    frame[1] = count;
+    if (!flushCallback(flushContext, frame, end)) {
+      return false; // Kayıtlar korunur, sonraki döngüde tekrar denenir
+    }
+    totalFrames++;
+    
+    memmove(frame + AGGREGATE_HEADER_SIZE, frame + end, frameSize - end);
+    frameSize -= end - AGGREGATE_HEADER_SIZE;
+    recordCount -= count;
+  }
+  
+  reset();
+  return true;
+}
+
+uint8_t UplinkAggregator::pendingRecords() const {
+  return recordCount;
+}
+
+uint8_t UplinkAggregator::pendingBytes() const {
+  return recordCount ? frameSize : 0;
+}
+
+uint32_t UplinkAggregator::getRecordCount() const {
+  return totalRecords;
+}
+
+uint32_t UplinkAggregator::getFrameCount() const {
+  return totalFrames;
+}
+
+uint32_t UplinkAggregator::getDroppedCount() const {
+  return droppedRecords;
+}
+
+void UplinkAggregator::dropOversizeRecords() {
+  uint8_t read = AGGREGATE_HEADER_SIZE;
+  uint8_t write = AGGREGATE_HEADER_SIZE;
+  uint8_t kept = 0;
+  for (uint8_t i = 0; i < recordCount; i++) {
+    uint8_t recordSize = AGGREGATE_RECORD_HEADER + frame[read + 1];
+    if (AGGREGATE_HEADER_SIZE + recordSize > maxFrameSize) {
+      droppedRecords++;
+    } else {
+      memmove(frame + write, frame + read, recordSize);
+      write += recordSize;
+      kept++;
+    }
+    read += recordSize;
+  }
+  frameSize = write;
+  recordCount = kept;
+}
+
+void UplinkAggregator::reset() {
+  frame[0] = AGGREGATE_FRAME_VERSION << 4;
+  frame[1] = 0;
+  frameSize = AGGREGATE_HEADER_SIZE;
+  recordCount = 0;
+}
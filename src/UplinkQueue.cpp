@@ -0,0 +1,187 @@
+#include "../Features/Messaging/UplinkQueue.h"
+
+UplinkQueue::UplinkQueue() :
+  count(0),
+  nextSequence(0),
+  headIndex(-1),
+  dropPolicy(DROP_LOWEST_PRIORITY) {
+  memset(used, 0, sizeof(used));
+  memset(&stats, 0, sizeof(stats));
+}
+
+void UplinkQueue::setDropPolicy(DropPolicy policy) {
+  dropPolicy = policy;
+}
+
+DropPolicy UplinkQueue::getDropPolicy() const {
+  return dropPolicy;
+}
+
+bool UplinkQueue::push(const uint8_t* data, uint8_t size, uint8_t port, uint8_t priority,
+                       uint32_t deadlineMs, bool critical) {
+  if (!data || size == 0 || size > UPLINK_SLOT_SIZE) {
+    stats.rejected++;
+    return false;
+  }
+  
+  uint32_t now = Utils::getTimestamp();
+  expire(now);
+  
+  int8_t index = findFree();
+  if (index < 0) {
+    if (dropPolicy == DROP_REJECT) {
+      stats.rejected++;
+      return false;
+    }
+    
+    int8_t victim = findVictim();
+    
+    // Düşük öncelikli mesaj, daha önemli mesajların yerini alamaz
+    if (dropPolicy == DROP_LOWEST_PRIORITY && slots[victim].priority > priority) {
+      stats.rejected++;
+      return false;
+    }
+    
+    release(victim);
+    stats.droppedOverflow++;
+    index = victim;
+  }
+  
+  UplinkMessage& msg = slots[index];
+  memcpy(msg.data, data, size);
+  msg.size = size;
+  msg.port = port;
+  msg.priority = priority;
+  msg.critical = critical;
+  msg.sequence = nextSequence++;
+  msg.deadline = deadlineMs ? now + deadlineMs : 0;
+  if (msg.deadline == 0 && deadlineMs) {
+    msg.deadline = 1; // 0 değeri "süresiz" anlamına geldiği için kaydır
+  }
+  
+  used[index] = true;
+  count++;
+  stats.enqueued++;
+  stats.depth = count;
+  if (count > stats.maxDepth) {
+    stats.maxDepth = count;
+  }
+  
+  return true;
+}
+
+const UplinkMessage* UplinkQueue::peek() {
+  expire(Utils::getTimestamp());
+  
+  headIndex = -1;
+  for (uint8_t i = 0; i < UPLINK_QUEUE_CAPACITY; i++) {
+    if (!used[i]) continue;
+    
+    if (headIndex < 0 ||
+        slots[i].priority > slots[headIndex].priority ||
+        (slots[i].priority == slots[headIndex].priority &&
+         (int32_t)(slots[i].sequence - slots[headIndex].sequence) < 0)) {
+      headIndex = i;
+    }
+  }
+  
+  return headIndex < 0 ? nullptr : &slots[headIndex];
+}
+
+void UplinkQueue::pop() {
+  if (headIndex < 0 || !used[headIndex]) return;
+  
+  release(headIndex);
+  headIndex = -1;
+  stats.sent++;
+}
+
+void UplinkQueue::discard() {
+  if (headIndex < 0 || !used[headIndex]) return;
+  
+  release(headIndex);
+  headIndex = -1;
+  stats.droppedOversize++;
+}
+
+bool UplinkQueue::requeue(const UplinkMessage& message) {
+  uint32_t now = Utils::getTimestamp();
+  expire(now);
+  
+  int8_t index = findFree();
+  if (index < 0 || (message.deadline != 0 && (int32_t)(now - message.deadline) > 0)) {
+    stats.droppedInFlight++;
+    return false;
+  }
+  
+  slots[index] = message;
+  used[index] = true;
+  count++;
+  stats.requeued++;
+  stats.depth = count;
+  if (count > stats.maxDepth) {
+    stats.maxDepth = count;
+  }
+  
+  return true;
+}
+
+uint8_t UplinkQueue::depth() const {
+  return count;
+}
+
+bool UplinkQueue::isEmpty() const {
+  return count == 0;
+}
+
+const UplinkQueueStats& UplinkQueue::getStats() const {
+  return stats;
+}
+
+void UplinkQueue::expire(uint32_t now) {
+  for (uint8_t i = 0; i < UPLINK_QUEUE_CAPACITY; i++) {
+    if (used[i] && slots[i].deadline != 0 && (int32_t)(now - slots[i].deadline) > 0) {
+      release(i);
+      stats.droppedExpired++;
+    }
+  }
+}
+
+int8_t UplinkQueue::findFree() const {
+  for (uint8_t i = 0; i < UPLINK_QUEUE_CAPACITY; i++) {
+    if (!used[i]) return i;
+  }
+  return -1;
+}
+
+int8_t UplinkQueue::findVictim() const {
+  int8_t victim = -1;
+  for (uint8_t i = 0; i < UPLINK_QUEUE_CAPACITY; i++) {
+    if (!used[i]) continue;
+    
+    if (victim < 0) {
+      victim = i;
+      continue;
+    }
+    
+    bool older = (int32_t)(slots[i].sequence - slots[victim].sequence) < 0;
+    if (dropPolicy == DROP_LOWEST_PRIORITY) {
+      if (slots[i].priority < slots[victim].priority ||
+          (slots[i].priority == slots[victim].priority && older)) {
+        victim = i;
+      }
+    } else if (older) {
+      victim = i;
+    }
+  }
+  return victim;
+}
+
+void UplinkQueue::release(uint8_t index) {
+  used[index] = false;
+  count--;
+  stats.depth = count;
+  if (headIndex == (int8_t)index) {
+    headIndex = -1;
+  }
+}
@@ -0,0 +1,86 @@
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+// Host test programları için ortak yardımcılar
+//
+// Testler host/CMakeLists.txt ile derlenir ve ctest ile koşar; her program
+// başarısız CHECK sayısını çıkış kodu olarak döndürür. beginSimulation()
+// sanal saati açar, Utils::getTimestamp()'i ona bağlar, Serial çıktısını
+// susturur ve önceki koşudan kalan oturum dosyalarını siler.
+
+#include <Arduino.h>
+#include <stdio.h>
+#include "SimClock.h"
+#include "SimRadio.h"
+#include "SimLmic.h"
+#include "../Core/Utils/Utils.h"
+#include "../Core/Config/AppConfig.h"
+
+static int testFailures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+      fprintf(stderr, "%s:%d: CHECK başarısız: %s\n", __FILE__, __LINE__, #cond); \
+      testFailures++; \
+    } \
+  } while (0)
+
+#define CHECK_EQ(a, b) do { \
+    long long checkA = (long long)(a); \
+    long long checkB = (long long)(b); \
+    if (checkA != checkB) { \
+      fprintf(stderr, "%s:%d: CHECK_EQ başarısız: %s (%lld) != %s (%lld)\n", \
+              __FILE__, __LINE__, #a, checkA, #b, checkB); \
+      testFailures++; \
+    } \
+  } while (0)
+
+inline void removeSessionFiles() {
+  static const char* const keys[] = { "session", "fcnt" };
+  char path[128];
+  for (const char* key : keys) {
+    snprintf(path, sizeof(path), "%s.%s", SESSION_STORE_PATH, key);
+    remove(path);
+  }
+}
+
+inline void beginSimulation(bool keepSession = false) {
+  SimClock::setVirtual(true);
+  SimClock::setUs(1000000);
+  Utils::setClock(SimClock::nowMs);
+  Serial.setEcho(false);
+  randomSeed(1);
+  SimRadio::reset();
+  if (!keepSession) {
+    removeSessionFiles();
+  }
+}
+
+// step() her sanal milisaniyede bir çağrılır; done() doğru olunca veya
+// maxMs dolunca durur. Geçen sanal süre sonuç olarak döner
+template <typename Step, typename Done>
+uint32_t runUntil(uint32_t maxMs, Step step, Done done) {
+  uint32_t elapsed = 0;
+  while (elapsed < maxMs && !done()) {
+    step();
+    SimClock::advanceMs(1);
+    elapsed++;
+  }
+  return elapsed;
+}
+
+template <typename Step>
+void runFor(uint32_t ms, Step step) {
+  runUntil(ms, step, [] { return false; });
+}
+
+inline int finishTest(const char* name) {
+  if (testFailures) {
+    fprintf(stderr, "%s: %d hata\n", name, testFailures);
+  } else {
+    printf("%s: tamam\n", name);
+  }
+  return testFailures ? 1 : 0;
+}
+
+#endif // HOST_TEST_H
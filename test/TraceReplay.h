@@ -0,0 +1,81 @@
+#ifndef TRACE_REPLAY_H
+#define TRACE_REPLAY_H
+
+// TRACE_DUMP kaydını LoraManager ile simülasyonda yeniden oynatma
+//
+// Kayıttaki join-accept ve her uplink'in ağ yanıtı SimRadio'ya betiklenir;
+// veri uplink'leri kayıttaki zamanda ve boyutta (ACK/NACK görülenler onaylı)
+// yeniden gönderilir. Oynatmanın kendi izi döküm olarak alınıp SimTrace'e
+// yüklenir; kayıtla karşılaştırma çağırana kalır. Sanal saat çağıran
+// tarafından kurulmuş olmalıdır (beginSimulation).
+
+#include <vector>
+#include "HostTest.h"
+#include "SimTrace.h"
+#include "../Core/Lora/LoraManager.h"
+#include "../Core/Lora/Airtime.h"
+
+// Dökümü belleğe yazan Print
+class BufferPrint : public Print {
+public:
+  size_t write(uint8_t value) override {
+    data.push_back(value);
+    return 1;
+  }
+  size_t write(const uint8_t* buffer, size_t size) override {
+    data.insert(data.end(), buffer, buffer + size);
+    return size;
+  }
+  std::vector<uint8_t> data;
+};
+
+inline void countTxDone(void* context, const LoraEvent& event) {
+  (void)event;
+  (*static_cast<uint32_t*>(context))++;
+}
+
+// Oynatılan veri uplink'i sayısı döner; replayed oynatmanın izini alır
+inline uint16_t replayTrace(const SimTrace& recorded, LoraManager& lora, SimTrace& replayed) {
+  recorded.scriptJoin();
+
+  uint32_t start = Utils::getTimestamp();
+  uint32_t completed = 0;
+  lora.setup();
+  lora.subscribe(LORA_EVENTS_TX_DONE, countTxDone, &completed);
+  auto step = [&] { lora.loop(); };
+
+  uint16_t sent = 0;
+  for (uint16_t i = 0; i < recorded.uplinkCount(); i++) {
+    const SimTraceUplink& u = recorded.uplink(i);
+    if (u.join || !u.completed || u.result != EV_TXCOMPLETE) {
+      continue; // Join istekleri LoraManager'ın kendi durum makinesinden gelir
+    }
+
+    // Kayıttaki ana kadar bekle (join daha uzun sürdüyse hemen gönder)
+    runUntil(JOIN_ATTEMPT_TIMEOUT_MS * 4, step, [&] {
+      return lora.isJoined() && Utils::getTimestamp() - start >= u.atMs &&
+             !(LMIC.opmode & OP_TXRXPEND);
+    });
+
+    uint8_t payload[UPLINK_SLOT_SIZE] = { 0 };
+    uint8_t size = u.length > LORAWAN_FRAME_OVERHEAD ? u.length - LORAWAN_FRAME_OVERHEAD : 1;
+    bool confirmed = (u.txrxFlags & (TXRX_ACK | TXRX_NACK)) != 0;
+    recorded.queueResponse(i);
+
+    uint32_t before = completed;
+    if (!lora.sendData(payload, size, 1, confirmed)) {
+      break;
+    }
+    runUntil(60000, step, [&] { return completed != before; });
+    sent++;
+  }
+
+  lora.unsubscribe(countTxDone, &completed);
+
+  BufferPrint dump;
+  lora.getEventTrace().dump(dump);
+  replayed.load(dump.data.data(), dump.data.size());
+  return sent;
+}
+
+#endif // TRACE_REPLAY_H
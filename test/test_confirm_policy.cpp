@@ -0,0 +1,102 @@
+// ConfirmPolicy: ACK aralığının (N) uyarlanması ve kaçınılan yayın süresi
+//
+// Politika varsayılan olarak onaysız gönderir ve her N. çerçevede ACK ister.
+// ACK'lar geldikçe N iki katına çıkar (CONFIRM_INTERVAL_MAX'a kadar), ACK
+// başarı oranı CONFIRM_RATE_POOR_PERCENT altına düşünce yarıya iner
+// (CONFIRM_INTERVAL_MIN'e kadar). Kritik mesaj her zaman onaylıdır.
+// Onaysız her çerçeve ACK downlink süresini ve gözlenen kayıp oranına göre
+// beklenen yeniden iletimleri "kaçınılan yayın süresi" olarak sayar.
+
+#include "HostTest.h"
+#include "../Features/Messaging/ConfirmPolicy.h"
+
+#define UPLINK_AIRTIME_MS 100
+#define ACK_AIRTIME_MS    40
+
+// MessageService gibi sürer: onaylı çerçeveye kadar gönderir, sonucu bildirir.
+// Onaylı çerçeveden önceki onaysız çerçeve sayısını döndürür
+static uint32_t sendUntilConfirmed(ConfirmPolicy& policy, bool acked) {
+  uint32_t unconfirmed = 0;
+  for (;;) {
+    bool confirmed = policy.shouldConfirm(false);
+    policy.onSent(confirmed, UPLINK_AIRTIME_MS, ACK_AIRTIME_MS);
+    if (confirmed) {
+      policy.onConfirmedResult(acked);
+      return unconfirmed;
+    }
+    unconfirmed++;
+  }
+}
+
+int main() {
+  beginSimulation();
+  ConfirmPolicy policy;
+  const ConfirmPolicyStats& stats = policy.getStats();
+  CHECK_EQ(stats.ackInterval, CONFIRM_INTERVAL_DEFAULT);
+  CHECK_EQ(stats.ackRatePercent, 100);
+
+  // ---- Sağlıklı bağlantı: N her ACK'ta iki katına çıkar ----
+  static_assert(CONFIRM_INTERVAL_DEFAULT == 8 && CONFIRM_INTERVAL_MAX == 64 && CONFIRM_INTERVAL_MIN == 2,
+                "beklenen değerler varsayılan AppConfig ayarlarına göredir");
+  static const uint8_t growing[] = { 16, 32, 64, 64 };
+  uint32_t unconfirmed = 0;
+  uint32_t interval = CONFIRM_INTERVAL_DEFAULT;
+  for (uint8_t next : growing) {
+    CHECK_EQ(sendUntilConfirmed(policy, true), interval - 1);
+    unconfirmed += interval - 1;
+    CHECK_EQ(stats.ackInterval, next);
+    interval = next;
+  }
+  CHECK_EQ(stats.confirmedSent, 4);
+  CHECK_EQ(stats.acked, 4);
+  CHECK_EQ(stats.unconfirmedSent, unconfirmed);
+  // Kayıp yokken yalnızca ACK downlink'inden kaçınılır
+  CHECK_EQ(stats.savedAirtimeMs, unconfirmed * ACK_AIRTIME_MS);
+
+  // ---- Kritik mesaj N'den bağımsız olarak onaylıdır ----
+  CHECK(!policy.shouldConfirm(false));
+  CHECK(policy.shouldConfirm(true));
+  policy.onSent(true, UPLINK_AIRTIME_MS, ACK_AIRTIME_MS);
+  policy.onConfirmedResult(true);
+  CHECK_EQ(stats.confirmedSent, 5);
+  // Onaylı çerçeve sayacı sıfırlar: sıradaki ACK yine N çerçeve sonra
+  CHECK_EQ(sendUntilConfirmed(policy, true), CONFIRM_INTERVAL_MAX - 1);
+
+  // ---- ACK'lar kayboluyor: oran düşer, N yarıya iner ----
+  // Oran (x/256): 192 (%75), 144 (%56), 108 (%42), 81 (%32), 60, 45, 33, 24
+  static const uint8_t ratePercent[] = { 75, 56, 42, 32, 23, 18, 13, 9 };
+  static const uint8_t shrinking[] = { 64, 64, 32, 16, 8, 4, 2, 2 };
+  for (uint8_t i = 0; i < sizeof(shrinking); i++) {
+    sendUntilConfirmed(policy, false);
+    CHECK_EQ(stats.ackRatePercent, ratePercent[i]);
+    CHECK_EQ(stats.ackInterval, shrinking[i]);
+  }
+  CHECK_EQ(stats.missed, sizeof(shrinking));
+
+  // Kayıp varken onaysız çerçeve beklenen yeniden iletimleri de kazandırır:
+  // oran 24/256 -> 40 + 100 * 232 / 24 = 1006 ms
+  uint32_t savedBefore = stats.savedAirtimeMs;
+  CHECK(!policy.shouldConfirm(false));
+  policy.onSent(false, UPLINK_AIRTIME_MS, ACK_AIRTIME_MS);
+  CHECK_EQ(stats.savedAirtimeMs - savedBefore, ACK_AIRTIME_MS + UPLINK_AIRTIME_MS * 232 / 24);
+  CHECK(policy.shouldConfirm(false));
+  policy.onSent(true, UPLINK_AIRTIME_MS, ACK_AIRTIME_MS);
+  policy.onConfirmedResult(true);
+
+  // ---- Bağlantı düzelir: oran %90'ı geçince N yeniden büyür ----
+  // 82, 125, 157, 181, 199, 213, 223, 231 (%90)
+  uint8_t acksUntilGrowth = 1;
+  while (stats.ackInterval == CONFIRM_INTERVAL_MIN && acksUntilGrowth < 32) {
+    sendUntilConfirmed(policy, true);
+    acksUntilGrowth++;
+  }
+  CHECK_EQ(acksUntilGrowth, 8);
+  CHECK_EQ(stats.ackInterval, 2 * CONFIRM_INTERVAL_MIN);
+  CHECK(stats.ackRatePercent >= CONFIRM_RATE_GOOD_PERCENT);
+
+  printf("ACK isteyen %lu, istemeyen %lu, kaçınılan yayın süresi %lu ms\n",
+         (unsigned long)stats.confirmedSent, (unsigned long)stats.unconfirmedSent,
+         (unsigned long)stats.savedAirtimeMs);
+
+  return finishTest("test_confirm_policy");
+}
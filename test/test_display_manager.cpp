@@ -0,0 +1,147 @@
+// DisplayManager: yalnızca değişen SSD1306 bölgelerinin aktarımı
+//
+// Wire yedeği I2C'ye yazılan byte'ları sayar. İlk aktarımda ekran belleği
+// bilinmediği için her sayfa tamamen gönderilir; sonraki karelerde yalnızca
+// değişen sayfa/sütun aralığı gider. DisplayStats::bytesSent Wire'ın
+// saydığıyla aynı olmalı, bytesSaved tam 1 KB çerçeve aktarımına göre
+// (pencere komutları + 1024 veri + 31 byte'lık parça başına kontrol byte'ı)
+// gönderilmeyen byte'ları vermelidir.
+//
+// service() zamanlayıcısı sanal saatle sürülür: bir kare aralığında
+// (1000 / DISPLAY_MAX_FPS ms) gelen güncellemeler tek karede birleşir ve
+// coalescedUpdates ile sayılır; radioBusy doğruyken ve ekran kapalıyken hiç
+// çizim yapılmaz, bekleyen güncelleme sonradan tek karede çizilir.
+
+#include "HostTest.h"
+#include "../Core/Display/DisplayManager.h"
+
+static const uint32_t kFullFrameBytes = 7 + OLED_WIDTH * OLED_PAGES +
+                                        (OLED_WIDTH * OLED_PAGES + OLED_I2C_CHUNK - 1) / OLED_I2C_CHUNK;
+
+static DisplayManager screen;
+static DisplayManager scheduled;
+
+// Kare başına Wire ve DisplayStats farkları
+struct FrameBytes {
+  uint32_t wire;
+  uint32_t sent;
+  uint32_t saved;
+};
+
+static FrameBytes renderAndMeasure() {
+  uint32_t wireBefore = Wire.bytesWritten;
+  DisplayStats before = screen.getStats();
+  screen.renderNow();
+  const DisplayStats& after = screen.getStats();
+  FrameBytes bytes = { Wire.bytesWritten - wireBefore, after.bytesSent - before.bytesSent,
+                       after.bytesSaved - before.bytesSaved };
+  return bytes;
+}
+
+int main() {
+  beginSimulation();
+  CHECK(screen.begin());
+
+  // ---- İlk kare: tüm sayfalar (sayfa başına pencere + 128 veri + 5 kontrol byte'ı) ----
+  screen.showDebugInfo("RSSI -97 SNR 7.5");
+  FrameBytes first = renderAndMeasure();
+  const uint32_t pageBytes = 7 + OLED_WIDTH + (OLED_WIDTH + OLED_I2C_CHUNK - 1) / OLED_I2C_CHUNK;
+  CHECK_EQ(first.sent, OLED_PAGES * pageBytes);
+  CHECK_EQ(first.wire, first.sent);
+  CHECK_EQ(first.saved, 0);
+
+  // ---- Tek satırda birkaç karakter değişir: yalnızca o sayfanın aralığı ----
+  screen.showDebugInfo("RSSI -98 SNR 7.5");
+  FrameBytes partial = renderAndMeasure();
+  CHECK_EQ(partial.wire, partial.sent);
+  CHECK(partial.sent > 0);
+  CHECK(partial.sent < pageBytes);
+  CHECK_EQ(partial.saved, kFullFrameBytes - partial.sent);
+
+  // ---- Değişiklik yok: hiçbir şey gönderilmez, kare atlanır ----
+  uint32_t skippedBefore = screen.getStats().skippedFrames;
+  FrameBytes unchanged = renderAndMeasure();
+  CHECK_EQ(unchanged.wire, 0);
+  CHECK_EQ(unchanged.sent, 0);
+  CHECK_EQ(unchanged.saved, kFullFrameBytes);
+  CHECK_EQ(screen.getStats().skippedFrames, skippedBefore + 1);
+
+  // ---- Görünüm değişimi: birkaç sayfa, yine tam kareden az ----
+  screen.showSendStatus("Hello World", true);
+  FrameBytes viewChange = renderAndMeasure();
+  CHECK_EQ(viewChange.wire, viewChange.sent);
+  CHECK(viewChange.sent < kFullFrameBytes);
+  CHECK_EQ(viewChange.saved, kFullFrameBytes - viewChange.sent);
+
+  // Toplam sayaçlar Wire ile tutarlı
+  const DisplayStats& stats = screen.getStats();
+  CHECK_EQ(stats.frames, 4);
+  CHECK_EQ(stats.bytesSent, first.sent + partial.sent + viewChange.sent);
+  CHECK_EQ(stats.bytesSaved, partial.saved + unchanged.saved + viewChange.saved);
+
+  printf("Tam kare %lu byte; ilk %lu, tek satır %lu, değişmeyen %lu, görünüm değişimi %lu byte\n",
+         (unsigned long)kFullFrameBytes, (unsigned long)first.sent, (unsigned long)partial.sent,
+         (unsigned long)unchanged.sent, (unsigned long)viewChange.sent);
+
+  // ---- Kare hızı sınırı ve birleştirme ----
+  const uint32_t frameMs = 1000 / DISPLAY_MAX_FPS;
+  CHECK(scheduled.begin());
+  scheduled.service();
+  CHECK_EQ(scheduled.getStats().renders, 0);   // Kirli değil
+
+  scheduled.showLoRaStatus("JOIN", false);
+  scheduled.service();
+  CHECK_EQ(scheduled.getStats().renders, 1);   // İlk kare beklemeden çizilir
+
+  // Bir kare aralığında dört güncelleme: tek kare, üçü birleşir
+  scheduled.showLoRaStatus("JOIN 1", false);
+  SimClock::advanceMs(10);
+  scheduled.showLoRaStatus("JOIN 2", false);
+  scheduled.service();
+  SimClock::advanceMs(10);
+  scheduled.showSendStatus("Hello", true);
+  scheduled.service();
+  scheduled.showSendStatus("Hello World", true);
+  SimClock::advanceMs(frameMs - 30);
+  scheduled.service();
+  CHECK_EQ(scheduled.getStats().renders, 1);
+  CHECK_EQ(scheduled.getStats().coalescedUpdates, 3);
+  SimClock::advanceMs(10);
+  scheduled.service();
+  CHECK_EQ(scheduled.getStats().renders, 2);
+  scheduled.service();
+  SimClock::advanceMs(frameMs);
+  scheduled.service();
+  CHECK_EQ(scheduled.getStats().renders, 2);   // Yeni güncelleme yok
+
+  // ---- Radyo meşgulken çizim ertelenir ----
+  scheduled.showLoRaStatus("TX", true);
+  for (uint32_t i = 0; i < 4 * frameMs; i++) {
+    scheduled.service(true);
+    if (i == frameMs) {
+      scheduled.showLoRaStatus("RX1", true);
+    }
+    SimClock::advanceMs(1);
+  }
+  CHECK_EQ(scheduled.getStats().renders, 2);
+  CHECK_EQ(scheduled.getStats().coalescedUpdates, 4);
+  scheduled.service(false);
+  CHECK_EQ(scheduled.getStats().renders, 3);
+
+  // ---- Ekran kapalıyken çizilmez; açılınca birikenler tek karede ----
+  SimClock::advanceMs(frameMs);
+  scheduled.turnOff();
+  scheduled.showDebugInfo("uyku");
+  scheduled.showDebugInfo("uyku 2");
+  SimClock::advanceMs(frameMs);
+  scheduled.service();
+  CHECK_EQ(scheduled.getStats().renders, 3);
+  scheduled.turnOn();
+  scheduled.service();
+  CHECK_EQ(scheduled.getStats().renders, 4);
+
+  printf("Zamanlayıcı: %lu kare, %lu güncelleme birleştirildi\n",
+         (unsigned long)scheduled.getStats().renders, (unsigned long)scheduled.getStats().coalescedUpdates);
+
+  return finishTest("test_display_manager");
+}
@@ -0,0 +1,174 @@
+// Downlink dağıtıcısı ve komut ayrıştırıcısı: bulanık girdi ve verim
+//
+// 1) Komutların anlamı: aralık ayarı ve sınırları, eksik argüman, bilinmeyen
+//    işlem kodu, durum yanıtı. Durum yanıtındaki çalışma süresi sanal saatten
+//    (Utils::getTimestamp) gelmelidir.
+// 2) Ayrı bir DownlinkDispatcher'a rastgele portlardan, rastgele boyut ve
+//    içerikte iki milyon çerçeve verilir. Yükler tam boyunda ayrılır (ASan ile
+//    derlendiğinde sınır dışı okuma yakalanır); komut portunda LoraManager'a
+//    bağlı olmayan bir DownlinkCommands (durum yanıtı ve DR ayarı reddedilir),
+//    diğer portta PayloadView'in tüm okuma yollarını rastgele deneyen bir
+//    işleyici vardır. Sayaçlar tutarlı olmalıdır.
+// 3) 51 byte'lık komut çerçevelerinde dağıtım verimi yazdırılır.
+
+#include <chrono>
+#include <stdlib.h>
+#include "HostTest.h"
+#include "../Core/Lora/LoraManager.h"
+#include "../Features/Messaging/DownlinkCommands.h"
+#include "../Features/Messaging/DownlinkDispatcher.h"
+#include "../Features/Messaging/MessageService.h"
+
+#define RAW_READ_PORT 20
+
+static LoraManager lora;
+static MessageService messages;
+static DownlinkDispatcher dispatcher;
+static DownlinkCommands commands;
+
+static uint32_t rng = 12345;
+static uint64_t sink = 0;
+
+static uint32_t nextRandom() {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+// Okumalar sona taşsa da görünüm dışına çıkmamalı
+static void rawReads(void* context, uint8_t port, PayloadView payload) {
+  (void)context;
+  (void)port;
+  for (uint8_t i = 0; i < 8; i++) {
+    switch (nextRandom() % 6) {
+      case 0: sink += payload.readU8(); break;
+      case 1: sink += payload.readU16(); break;
+      case 2: sink += payload.readU32(); break;
+      case 3: {
+        PayloadView view = payload.readView(nextRandom() % 260);
+        sink += view.size();
+        if (view.size()) {
+          sink += view.data()[view.size() - 1];
+        }
+        break;
+      }
+      case 4: sink += payload.at(nextRandom() % 256); break;
+      case 5: {
+        PayloadView view = payload.slice(nextRandom() % 256, nextRandom() % 256);
+        if (view.size()) {
+          sink += view.data()[view.size() - 1];
+        }
+        break;
+      }
+    }
+  }
+}
+
+static void step() {
+  lora.loop();
+  messages.loop();
+}
+
+static void fuzzDispatcher(uint32_t frames) {
+  static DownlinkDispatcher target;
+  static DownlinkCommands parser;
+  CHECK(parser.begin(target, nullptr, nullptr));
+  CHECK(target.on(RAW_READ_PORT, rawReads, nullptr));
+  uint32_t routed = 0;
+  uint32_t macOnly = 0;
+
+  for (uint32_t i = 0; i < frames; i++) {
+    uint8_t length = nextRandom() % 243;
+    uint8_t* buffer = (uint8_t*)malloc(length ? length : 1);
+    for (uint8_t k = 0; k < length; k++) {
+      buffer[k] = nextRandom();
+    }
+    uint8_t port = (i & 1) ? DOWNLINK_COMMAND_PORT : (i & 2) ? RAW_READ_PORT : nextRandom() & 0xFF;
+    macOnly += port == 0;   // LMIC'e ait; sayılmaz
+    routed += target.dispatch(port, PayloadView(length ? buffer : nullptr, length));
+    free(buffer);
+  }
+
+  const DownlinkDispatchStats& stats = target.getStats();
+  CHECK_EQ(stats.dispatched, routed);
+  CHECK_EQ(stats.dispatched + stats.unrouted + macOnly, frames);
+  CHECK(routed >= frames * 3 / 4);
+  printf("Bulanık girdi: %lu çerçeve, %lu dağıtıldı, %lu komut uygulandı, %lu reddedildi, %lu bilinmeyen\n",
+         (unsigned long)frames, (unsigned long)routed, (unsigned long)parser.getStats().executed,
+         (unsigned long)parser.getStats().rejected, (unsigned long)parser.getStats().unknown);
+}
+
+int main() {
+  beginSimulation();
+  lora.setDownlinkHandler(DownlinkDispatcher::onDownlink, &dispatcher);
+  CHECK(commands.begin(dispatcher, &lora, &messages));
+  lora.setup();
+  messages.setup(&lora);
+
+  // ---- Port kayıtları ----
+  CHECK(!dispatcher.on(0, rawReads, nullptr));
+  CHECK(!dispatcher.on(DOWNLINK_PORT_MAX + 1, rawReads, nullptr));
+  for (uint8_t port = 30; port < 30 + DOWNLINK_ROUTES - 1; port++) {
+    CHECK(dispatcher.on(port, rawReads, nullptr));
+  }
+  CHECK(!dispatcher.on(99, rawReads, nullptr));     // Yuvalar dolu
+  CHECK(dispatcher.off(30));
+  CHECK(dispatcher.on(99, rawReads, nullptr));
+
+  // ---- Komutların anlamı ----
+  runUntil(60000, step, [] { return lora.isJoined(); });
+  CHECK(lora.isJoined());
+  runUntil(60000, step, [] { return messages.isIdle(); });
+  DownlinkCommandStats stats = commands.getStats();
+
+  const uint8_t setInterval[] = { DOWNLINK_OP_SET_INTERVAL, 0x01, 0x2C };   // 300 sn
+  CHECK(dispatcher.dispatch(DOWNLINK_COMMAND_PORT, PayloadView(setInterval, sizeof(setInterval))));
+  CHECK_EQ(commands.getSendIntervalMs(), 300000);
+
+  const uint8_t tooShort[] = { DOWNLINK_OP_SET_INTERVAL, 0x00, DOWNLINK_MIN_INTERVAL_S - 1 };
+  const uint8_t truncated[] = { DOWNLINK_OP_SET_INTERVAL, 0x01 };
+  const uint8_t unknown[] = { 0x7F, DOWNLINK_OP_SET_INTERVAL, 0x00, 0x3C };
+  dispatcher.dispatch(DOWNLINK_COMMAND_PORT, PayloadView(tooShort, sizeof(tooShort)));
+  dispatcher.dispatch(DOWNLINK_COMMAND_PORT, PayloadView(truncated, sizeof(truncated)));
+  dispatcher.dispatch(DOWNLINK_COMMAND_PORT, PayloadView(unknown, sizeof(unknown)));
+  CHECK_EQ(commands.getSendIntervalMs(), 300000);
+  CHECK_EQ(commands.getStats().executed - stats.executed, 1);
+  CHECK_EQ(commands.getStats().rejected - stats.rejected, 2);
+  CHECK_EQ(commands.getStats().unknown - stats.unknown, 1);
+
+  // Durum yanıtı: çalışma süresi gerçek millis() değil uygulama saati
+  const uint8_t status[] = { DOWNLINK_OP_STATUS };
+  uint32_t uptime = Utils::getTimestamp() / 1000;
+  CHECK(uptime > millis() / 1000);
+  CHECK(dispatcher.dispatch(DOWNLINK_COMMAND_PORT, PayloadView(status, sizeof(status))));
+  runUntil(60000, step, [] { return (LMIC.opmode & OP_TXRXPEND) != 0; });
+  CHECK_EQ(LMIC.pendTxPort, DOWNLINK_STATUS_PORT);
+  CHECK_EQ(LMIC.pendTxData[0], DOWNLINK_OP_STATUS);
+  uint32_t reported = ((uint32_t)LMIC.pendTxData[1] << 24) | ((uint32_t)LMIC.pendTxData[2] << 16) |
+                      ((uint32_t)LMIC.pendTxData[3] << 8) | LMIC.pendTxData[4];
+  CHECK_EQ(reported, uptime);
+  CHECK_EQ(((uint16_t)LMIC.pendTxData[5] << 8) | LMIC.pendTxData[6], 300);
+
+  // ---- Bulanık girdi ----
+  fuzzDispatcher(2000000);
+
+  // ---- Verim: 17 aralık komutlu 51 byte'lık çerçeveler ----
+  uint8_t frame[51];
+  for (uint8_t k = 0; k < sizeof(frame); k += 3) {
+    frame[k] = DOWNLINK_OP_SET_INTERVAL;
+    frame[k + 1] = 0x00;
+    frame[k + 2] = 60;
+  }
+  const uint32_t rounds = 1000000;
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < rounds; i++) {
+    dispatcher.dispatch(DOWNLINK_COMMAND_PORT, PayloadView(frame, sizeof(frame)));
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  CHECK_EQ(commands.getSendIntervalMs(), 60000);
+  printf("Verim: %.2f M çerçeve/sn (%.0f ns/çerçeve, 17 komut) [%llu]\n",
+         rounds / seconds / 1e6, seconds / rounds * 1e9, (unsigned long long)(sink & 0xFF));
+
+  return finishTest("test_downlink_commands");
+}
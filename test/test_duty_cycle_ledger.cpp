@@ -0,0 +1,129 @@
+// DutyCycleLedger: alt bant başına kapalı kalma süreleri
+//
+// EU868'de varsayılan kanallar %1 (BAND_CENTI) bandındadır; testte %10'luk
+// (BAND_DECI) bir kanal eklenir. İletim kaydı bandı yayın süresi x bölen
+// kadar kapatır; nextSendTime() etkin kanalların bantlarından en erken
+// açılanı verir. Zaman karşılaştırmaları 32 bit ms saatinin sarmasından
+// ve derin uykudaki saat kaydırmasından etkilenmemelidir.
+
+#include "HostTest.h"
+#include "../Core/Lora/DutyCycleLedger.h"
+
+#define DECI_CHANNEL 3
+
+static void setupChannels() {
+  LMIC_reset();
+  CHECK(LMIC_setupChannel(DECI_CHANNEL, 869525000, DR_RANGE_MAP(DR_SF12, DR_SF7), BAND_DECI));
+  CHECK_EQ(DutyCycleLedger::bandOfChannel(0), BAND_CENTI);
+  CHECK_EQ(DutyCycleLedger::bandOfChannel(DECI_CHANNEL), BAND_DECI);
+  CHECK_EQ(DutyCycleLedger::dutyDivider(BAND_CENTI), 100);
+  CHECK_EQ(DutyCycleLedger::dutyDivider(BAND_DECI), 10);
+}
+
+int main() {
+  beginSimulation();
+  setupChannels();
+
+  // ---- Yayın süresi ----
+  // SF9/125 kHz'de 23 byte'lık join-request (10 byte yük + 13 byte ek yük)
+  CHECK_EQ(DutyCycleLedger::uplinkAirtimeMs(DR_SF9, 10), 206);
+  CHECK_EQ(DutyCycleLedger::uplinkAirtimeMs(DR_SF7, 51), Airtime::uplinkMs(7, 51));
+  CHECK(DutyCycleLedger::uplinkAirtimeMs(DR_SF12, 51) > DutyCycleLedger::uplinkAirtimeMs(DR_SF11, 51));
+
+  // ---- İki bant ----
+  {
+    DutyCycleLedger ledger;
+    uint32_t now = Utils::getTimestamp();
+    CHECK(ledger.canSendNow());
+    CHECK_EQ(ledger.nextSendTime(), now);
+
+    // %1 bant 100 ms iletimden sonra 10 sn kapalı; %10 bant hâlâ açık
+    ledger.recordTransmission(BAND_CENTI, 100);
+    CHECK_EQ(ledger.bandAvailableAt(BAND_CENTI), now + 10000);
+    CHECK_EQ(ledger.nextSendTime(), now);
+    CHECK(ledger.canSendNow());
+
+    // İki bant da kapalı: en erken açılan (%10, 1 sn) belirler
+    ledger.recordTransmission(BAND_DECI, 100);
+    CHECK_EQ(ledger.nextSendTime(), now + 1000);
+    CHECK(!ledger.canSendNow());
+    SimClock::advanceMs(999);
+    CHECK(!ledger.canSendNow());
+    SimClock::advanceMs(1);
+    CHECK(ledger.canSendNow());
+    CHECK_EQ(ledger.nextSendTime(), now + 1000);
+
+    // Kapalı kanalın bandı hesaba katılmaz
+    ledger.recordTransmission(BAND_DECI, 50);
+    CHECK(LMIC_disableChannel(DECI_CHANNEL));
+    CHECK_EQ(ledger.nextSendTime(), now + 10000);
+    LMIC_enableChannel(DECI_CHANNEL);
+    CHECK_EQ(ledger.nextSendTime(), now + 1500);
+
+    CHECK_EQ(ledger.totalAirtimeMs(BAND_CENTI), 100);
+    CHECK_EQ(ledger.totalAirtimeMs(BAND_DECI), 150);
+
+    // Geçersiz bant yok sayılır
+    ledger.recordTransmission(DUTY_CYCLE_BANDS, 100);
+    CHECK_EQ(ledger.bandAvailableAt(DUTY_CYCLE_BANDS), 0);
+    CHECK_EQ(ledger.totalAirtimeMs(DUTY_CYCLE_BANDS), 0);
+  }
+
+  // ---- LMIC'in o anki iletimi (EV_TXSTART) ----
+  {
+    DutyCycleLedger ledger;
+    uint32_t now = Utils::getTimestamp();
+    LMIC.txChnl = DECI_CHANNEL;
+    LMIC.rps = updr2rps(DR_SF9);
+    LMIC.dataLen = 23;
+    ledger.recordCurrentTransmission();
+    CHECK_EQ(ledger.totalAirtimeMs(BAND_DECI), 206);
+    CHECK_EQ(ledger.bandAvailableAt(BAND_DECI), now + 2060);
+    CHECK_EQ(ledger.totalAirtimeMs(BAND_CENTI), 0);
+  }
+
+  // ---- 32 bit ms saatinin sarması ----
+  {
+    SimClock::setUs((0x100000000ULL - 2000) * 1000);
+    DutyCycleLedger ledger;
+    uint32_t now = Utils::getTimestamp();
+    CHECK_EQ(now, 0xFFFFFFFFUL - 1999);
+
+    CHECK(LMIC_disableChannel(DECI_CHANNEL));
+    ledger.recordTransmission(BAND_CENTI, 100);
+    uint32_t opensAt = now + 10000;
+    CHECK(opensAt < now);
+    CHECK_EQ(ledger.nextSendTime(), opensAt);
+    CHECK(!ledger.canSendNow());
+
+    SimClock::advanceMs(5000);          // Saat sarmış, bant hâlâ kapalı
+    CHECK(Utils::getTimestamp() < now);
+    CHECK(!ledger.canSendNow());
+    CHECK_EQ(ledger.nextSendTime(), opensAt);
+    SimClock::advanceMs(5000);
+    CHECK(ledger.canSendNow());
+    LMIC_enableChannel(DECI_CHANNEL);
+  }
+
+  // ---- Derin uyku: saat sıfırlanır, kapalı kalma süresi korunur ----
+  {
+    beginSimulation();
+    setupChannels();
+    DutyCycleLedger ledger;
+    uint32_t sleptAt = Utils::getTimestamp();
+    ledger.recordTransmission(BAND_CENTI, 100);
+    ledger.recordTransmission(BAND_DECI, 100);
+
+    // Uyku 400 ms sürdü; yeni saat sıfırdan başlar
+    ledger.shiftClock(sleptAt + 400);
+    SimClock::setUs(0);
+    CHECK_EQ(ledger.bandAvailableAt(BAND_DECI), 600);
+    CHECK_EQ(ledger.nextSendTime(), 600);
+    SimClock::advanceMs(600);
+    CHECK(ledger.canSendNow());
+    CHECK(LMIC_disableChannel(DECI_CHANNEL));
+    CHECK_EQ(ledger.nextSendTime(), 9600);
+  }
+
+  return finishTest("test_duty_cycle_ledger");
+}
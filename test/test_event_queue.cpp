@@ -0,0 +1,134 @@
+// Ertelenmiş LMIC olay kuyruğu: sıra ve taşma sayımı
+//
+// Önce LoraManager'ın kullandığı SpscQueue<LoraEvent> iki std::thread
+// arasında zorlanır: üretici enqueueEvent gibi kuyruk doluysa beklemeden
+// atar, tüketici sırayı denetler; teslim + atılan üretilene eşit olmalıdır.
+// Ardından olaylar SimLmic::injectEvent ile LMIC geri çağırması üzerinden
+// rastgele boyutlu patlamalar halinde LoraManager'a verilir ve her patlamadan
+// sonra loop() çağrılır: kuyruğa sığanlar aynı sırayla abonelere ulaşır,
+// sığmayanlar getEventQueueStats().dropped ile tam olarak sayılır.
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "HostTest.h"
+#include "../Core/Lora/LoraManager.h"
+#include "../Core/Utils/SpscQueue.h"
+
+static LoraManager lora;
+
+// Join akışında üretilmeyen olaylar; abone yalnızca bunları dinler
+static const ev_t kInjected[] = { EV_SCAN_TIMEOUT, EV_BEACON_FOUND, EV_BEACON_MISSED, EV_BEACON_TRACKED };
+static const uint8_t kInjectedCount = sizeof(kInjected) / sizeof(kInjected[0]);
+
+struct Delivery {
+  uint8_t received[64];
+  uint8_t count;
+};
+
+static void recordDelivery(void* context, const LoraEvent& event) {
+  Delivery* delivery = static_cast<Delivery*>(context);
+  if (delivery->count < sizeof(delivery->received)) {
+    delivery->received[delivery->count] = event.ev;
+  }
+  delivery->count++;
+}
+
+static bool crossThreadPreservesOrder(uint32_t count) {
+  static SpscQueue<LoraEvent, LORA_EVENT_QUEUE_CAPACITY> queue;
+  std::atomic<bool> producerDone(false);
+
+  std::thread producer([&] {
+    for (uint32_t i = 0; i < count; i++) {
+      LoraEvent event = {};
+      event.timestamp = i;
+      event.ev = kInjected[i % kInjectedCount];
+      queue.push(event);
+      if ((i & 63) == 0) {
+        std::this_thread::yield();
+      }
+    }
+    producerDone = true;
+  });
+
+  uint32_t delivered = 0;
+  uint32_t last = 0;
+  bool ordered = true;
+  for (;;) {
+    LoraEvent event;
+    if (queue.pop(event)) {
+      if ((delivered && event.timestamp <= last) || event.ev != kInjected[event.timestamp % kInjectedCount]) {
+        ordered = false;
+      }
+      last = event.timestamp;
+      delivered++;
+    } else if (producerDone && queue.isEmpty()) {
+      break;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+
+  printf("SpscQueue<LoraEvent>: %lu olay, %lu teslim, %lu atıldı\n", (unsigned long)count,
+         (unsigned long)delivered, (unsigned long)queue.getDropped());
+  return ordered && delivered + queue.getDropped() == count;
+}
+
+int main() {
+  CHECK(crossThreadPreservesOrder(3000000));
+
+  // Sanal saat durur: join isteğinin LMIC olayları ilk loop()'ta biter ve
+  // dolu kuyruğa LMIC'in kendi olayı düşmez
+  beginSimulation();
+  lora.setup();
+
+  Delivery delivery = {};
+  uint32_t mask = 0;
+  for (ev_t ev : kInjected) {
+    mask |= LORA_EVENT_MASK(ev);
+  }
+  CHECK(lora.subscribe(mask, recordDelivery, &delivery));
+
+  const uint16_t slots = LORA_EVENT_QUEUE_CAPACITY - 1;
+  const uint32_t total = 1000000;
+  uint32_t injected = 0;
+  uint32_t expectedDropped = 0;
+  uint32_t droppedBefore = lora.getEventQueueStats().dropped;
+  auto start = std::chrono::steady_clock::now();
+
+  while (injected < total) {
+    // loop() kuyruğu tamamen boşaltır; patlama boş kuyruğa düşer
+    lora.loop();
+    CHECK_EQ(lora.getEventQueueStats().pending, 0);
+
+    uint16_t burst = random(1, slots + 6);
+    delivery.count = 0;
+    for (uint16_t i = 0; i < burst; i++) {
+      SimLmic::injectEvent(kInjected[(injected + i) % kInjectedCount]);
+    }
+    lora.loop();
+
+    uint16_t accepted = burst < slots ? burst : slots;
+    expectedDropped += burst - accepted;
+    CHECK_EQ(delivery.count, accepted);
+    for (uint16_t i = 0; i < accepted && i < delivery.count; i++) {
+      if (delivery.received[i] != kInjected[(injected + i) % kInjectedCount]) {
+        CHECK_EQ(delivery.received[i], kInjected[(injected + i) % kInjectedCount]);
+        break;
+      }
+    }
+    injected += burst;
+  }
+
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  LoraEventQueueStats stats = lora.getEventQueueStats();
+  CHECK_EQ(stats.dropped - droppedBefore, expectedDropped);
+  CHECK_EQ(stats.maxDepth, slots);
+  CHECK_EQ(stats.pending, 0);
+
+  printf("LoraManager: %lu olay, %lu atıldı, %.0f olay/sn\n", (unsigned long)injected,
+         (unsigned long)expectedDropped, injected / seconds);
+
+  return finishTest("test_event_queue");
+}
@@ -0,0 +1,98 @@
+// Join durum makinesi: CFList korunur, zaman aşımı ve geri çekilme bloklamaz
+//
+// 1) Join-accept, bölge planından farklı CFList frekansları taşır; join
+//    sonrası kanal planı yeniden uygulanmadığı için ağın kanalları kalır.
+// 2) Ağ join isteklerine bir süre yanıt vermez; LoraManager denemeyi zaman
+//    aşımıyla keser, geri çekilir ve yeniden dener. Bu sırada loop()'un en
+//    kötü süresi PROFILE_SCOPE(PROF_LOOP) histogramından ölçülür. İletim
+//    sürerken yapılan sıfırlama MessageService'i beklemede bırakmamalı;
+//    sonucu gelmeyen çerçeve kuyruğa geri konur ve join sonrası gönderilir.
+
+#include "HostTest.h"
+#include "../Core/Lora/LoraManager.h"
+#include "../Core/Utils/Profiler.h"
+#include "../Features/Messaging/MessageService.h"
+
+static LoraManager lora;
+static MessageService messages;
+
+static void step() {
+  lora.loop();
+  messages.loop();
+}
+
+int main() {
+  beginSimulation();
+
+  // ---- Planla çakışmayan CFList ----
+  SimJoinAccept accept = SimRadio::defaultJoinAccept();
+  for (uint8_t i = 0; i < 5; i++) {
+    accept.cfListFreq[i] = 867200000 + 200000 * (uint32_t)i;
+  }
+  SimRadio::scriptJoinAccept(accept);
+
+  lora.setup();
+  messages.setup(&lora);
+  runUntil(60000, step, [] { return lora.isJoined(); });
+  CHECK(lora.isJoined());
+
+  // EV_JOINED işlendikten sonra da ağın kanalları yerinde kalmalı
+  runFor(2000, step);
+  for (uint8_t i = 0; i < 5; i++) {
+    CHECK_EQ(LMIC.channelFreq[3 + i] & ~3u, accept.cfListFreq[i]);
+    CHECK(LMIC.channelMap & (1 << (3 + i)));
+  }
+
+  // ---- Ağ yanıt vermiyor: zaman aşımı, geri çekilme, yeniden deneme ----
+  beginSimulation();
+  accept = SimRadio::defaultJoinAccept();
+  accept.attempt = 0;
+  SimRadio::scriptJoinAccept(accept);
+
+  // İletim sürerken sıfırlama: TXCOMPLETE gelmez, bekleme EV_JOINING ile düşer
+  uint8_t payload[4] = { 1, 2, 3, 4 };
+  CHECK(messages.sendData(payload, sizeof(payload), 1));
+  runUntil(60000, step, [] { return (LMIC.opmode & OP_TXRXPEND) != 0; });
+  CHECK(LMIC.opmode & OP_TXRXPEND);
+  CHECK(!messages.isIdle());
+
+  uint16_t nonceBefore = LMIC.devNonce;
+  lora.forgetSession();
+  Profiler::reset();
+
+  // Zaman aşımı (JOIN_ATTEMPT_TIMEOUT_MS) ve en az bir geri çekilme geçer
+  runFor(JOIN_ATTEMPT_TIMEOUT_MS + JOIN_BACKOFF_BASE_MS * 4, step);
+  CHECK(!lora.isJoined());
+  uint32_t unanswered = SimRadio::getStats().joinRequests;
+  CHECK(unanswered > 1);
+
+  // Ağ bir sonraki isteği kabul eder
+  accept.attempt = unanswered + 1;
+  SimRadio::scriptJoinAccept(accept);
+  runUntil(JOIN_ATTEMPT_TIMEOUT_MS * 2, step, [] { return lora.isJoined(); });
+  CHECK(lora.isJoined());
+  runUntil(60000, step, [] { return messages.isIdle(); });
+  CHECK(messages.isIdle());
+  CHECK_EQ(messages.getQueueStats().requeued, 1);
+  CHECK_EQ(messages.getQueueStats().droppedInFlight, 0);
+  const SimTransmission& resent = SimRadio::transmission(SimRadio::transmissionCount() - 1);
+  CHECK(!resent.join);
+  CHECK_EQ(resent.length, LORAWAN_FRAME_OVERHEAD + sizeof(payload));
+
+  // LMIC_reset'lere rağmen DevNonce her istekte ilerler
+  CHECK_EQ(LMIC.devNonce, nonceBefore + SimRadio::getStats().joinRequests);
+
+  // Bekleme delay() ile değil durum makinesiyle yapılır: tek bir loop() turu
+  // geri çekilme süresinin çok altında kalmalı
+  const ProfileHistogram& loopHist = Profiler::getHistogram(PROF_LOOP);
+  uint32_t worstUs = Profiler::cyclesToUs(loopHist.maxValue);
+  CHECK(loopHist.count > 0);
+  CHECK(worstUs < 100000);
+
+  printf("join isteği %lu, loop() turu %lu, en kötü loop() %lu µs\n",
+         (unsigned long)SimRadio::getStats().joinRequests,
+         (unsigned long)loopHist.count,
+         (unsigned long)worstUs);
+
+  return finishTest("test_join_state");
+}
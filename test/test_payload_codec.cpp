@@ -0,0 +1,103 @@
+// PayloadCodec: gidiş-dönüş, delta sarması, taşma ve işlem hızı
+//
+// Kodlanan her çerçeve ayrı durumlu bir okuyucuyla çözülür ve değerler
+// karşılaştırılır. Delta farkı int32_t sınırlarını aştığında uint32_t
+// sarmasıyla doğru geri çevrilmeli; sığmayan çerçeve durumu ilerletmemelidir.
+
+#include "HostTest.h"
+#include <chrono>
+#include "../Features/Encoding/PayloadCodec.h"
+
+#define FRAME_CHANNELS 4
+
+static bool roundTrip(PayloadDeltaState& writerState, PayloadDeltaState& readerState,
+                      bool keyFrame, const int32_t* values, uint8_t* frame, uint8_t capacity) {
+  PayloadWriter writer(frame, capacity, &writerState);
+  writer.begin(keyFrame);
+  for (uint8_t ch = 0; ch < FRAME_CHANNELS; ch++) {
+    writer.writeDelta(ch, values[ch]);
+  }
+  if (writer.hasOverflow()) {
+    return false;
+  }
+
+  PayloadReader reader(frame, writer.size(), &readerState);
+  if (!reader.begin() || reader.isKeyFrame() != keyFrame) {
+    return false;
+  }
+  for (uint8_t ch = 0; ch < FRAME_CHANNELS; ch++) {
+    if (reader.readDelta(ch) != values[ch]) {
+      return false;
+    }
+  }
+  return !reader.hasError() && reader.atEnd();
+}
+
+int main() {
+  uint8_t frame[32];
+
+  // ---- Temel alanlar ----
+  PayloadWriter writer(frame, sizeof(frame));
+  writer.begin(true);
+  writer.writeVarUint(300);
+  writer.writeVarInt(-1);
+  writer.writeFixed(-23.45f, 100);
+  writer.writeVarUint(0xFFFFFFFFu);
+  CHECK(!writer.hasOverflow());
+
+  PayloadReader reader(frame, writer.size());
+  CHECK(reader.begin());
+  CHECK_EQ(reader.readVarUint(), 300);
+  CHECK_EQ(reader.readVarInt(), -1);
+  CHECK_EQ(PayloadCodec::toFixed(reader.readFixed(100), 100), -2345);
+  CHECK_EQ(reader.readVarUint(), 0xFFFFFFFFu);
+  CHECK(reader.atEnd() && !reader.hasError());
+
+  // ---- Delta: int32_t sınırlarında sarma ----
+  PayloadDeltaState writerState, readerState;
+  const int32_t sequence[][FRAME_CHANNELS] = {
+    { 0, INT32_MAX, INT32_MIN, -5 },
+    { 1, INT32_MIN, INT32_MAX, 5 },          // Fark int32_t'ye sığmaz
+    { -1, INT32_MAX, INT32_MIN, INT32_MAX },
+    { INT32_MIN, 0, 0, INT32_MIN },
+  };
+  for (uint8_t i = 0; i < sizeof(sequence) / sizeof(sequence[0]); i++) {
+    CHECK(roundTrip(writerState, readerState, i == 0, sequence[i], frame, sizeof(frame)));
+  }
+
+  // ---- Taşma: sığmayan kanallar durumu ilerletmez ----
+  PayloadDeltaState before = writerState;
+  const int32_t large[FRAME_CHANNELS] = { 100000, 200000, 300000, 400000 };
+  CHECK(!roundTrip(writerState, readerState, false, large, frame, 6));
+  CHECK_EQ(writerState.previous[FRAME_CHANNELS - 1], before.previous[FRAME_CHANNELS - 1]);
+
+  // Taşmadan sonra anahtar çerçeve iki ucu yeniden eşitler
+  CHECK(roundTrip(writerState, readerState, true, large, frame, sizeof(frame)));
+  const int32_t next[FRAME_CHANNELS] = { 100001, 199999, 300000, -400000 };
+  CHECK(roundTrip(writerState, readerState, false, next, frame, sizeof(frame)));
+
+  // ---- Rastgele gidiş-dönüş ve işlem hızı ----
+  const uint32_t frames = 200000;
+  uint32_t seed = 12345;
+  int32_t values[FRAME_CHANNELS] = { 0 };
+  uint32_t mismatches = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < frames; i++) {
+    for (uint8_t ch = 0; ch < FRAME_CHANNELS; ch++) {
+      seed = seed * 1103515245u + 12345u;
+      // Çoğunlukla küçük adımlar, arada tam aralıkta sıçramalar
+      int32_t step = (seed >> 28) == 0 ? (int32_t)seed : (int32_t)(seed >> 20) - 2048;
+      values[ch] = (int32_t)((uint32_t)values[ch] + (uint32_t)step);
+    }
+    if (!roundTrip(writerState, readerState, i % 32 == 0, values, frame, sizeof(frame))) {
+      mismatches++;
+    }
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  CHECK_EQ(mismatches, 0);
+
+  printf("%lu çerçeve kodlandı/çözüldü, %.0f çerçeve/sn\n",
+         (unsigned long)frames, frames / (seconds > 0 ? seconds : 1e-9));
+
+  return finishTest("test_payload_codec");
+}
@@ -0,0 +1,156 @@
+// DUAL_CORE_MODE iş parçacığı modeli: iki std::thread arasında kuyruklar
+//
+// Önce SpscQueue tek başına zorlanır: üretici iş parçacığı sıra numaralı
+// kayıtları dolu kuyruğa yeniden deneyerek iter, ana iş parçacığı sırayı ve
+// içeriği doğrular. Ardından RadioTask gerçek bir iş parçacığında
+// LoraManager + MessageService'i döndürürken ana iş parçacığı (Arduino
+// loop()'u yerine) postData ile uplink ister ve serviceUi() ile radyo
+// tarafının kuyruklarını tüketir. Sanal saati yalnızca radyo iş parçacığı
+// ilerletir: sıradaki LMIC işine kadar, en fazla 100 ms'lik adımlarla.
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "HostTest.h"
+#include "../Core/Lora/Airtime.h"
+#include "../Core/Lora/RadioTask.h"
+#include "../Core/Utils/SpscQueue.h"
+#include "../Features/Messaging/MessageService.h"
+
+static LoraManager lora;
+static MessageService messages;
+static std::atomic<uint32_t> completed(0);
+static std::atomic<bool> joined(false);
+
+struct SequenceRecord {
+  uint32_t seq;
+  uint32_t pad[5];
+};
+
+static bool spscPreservesOrder(uint32_t count) {
+  static SpscQueue<SequenceRecord, 64> queue;
+  std::thread producer([count] {
+    for (uint32_t i = 0; i < count; i++) {
+      SequenceRecord r = { i, { i, i, i, i, i } };
+      while (!queue.push(r)) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  uint32_t expected = 0;
+  bool ordered = true;
+  while (expected < count) {
+    SequenceRecord r;
+    if (!queue.pop(r)) {
+      std::this_thread::yield();
+      continue;
+    }
+    if (r.seq != expected || r.pad[0] != expected || r.pad[4] != expected) {
+      ordered = false;
+      break;
+    }
+    expected++;
+  }
+  if (!ordered) {
+    // Üretici boşalan kuyrukta takılmasın
+    SequenceRecord r;
+    while (expected++ < count) {
+      while (!queue.pop(r)) {
+        std::this_thread::yield();
+      }
+    }
+  }
+  producer.join();
+  printf("SpscQueue: %lu kayıt, dolu kuyrukta %lu yeniden deneme\n",
+         (unsigned long)count, (unsigned long)queue.getDropped());
+  return ordered;
+}
+
+static void countCompleted(void* context, const LoraEvent& event) {
+  (void)context;
+  (void)event;
+  completed++;
+}
+
+static void onJoined(void* context, const LoraEvent& event) {
+  (void)context;
+  if (event.ev == EV_JOINED) {
+    joined = true;
+  }
+}
+
+// Radyo iş parçacığında her turda LoraManager::loop()'tan sonra çağrılır
+static void radioService(void* context) {
+  (void)context;
+  messages.loop();
+
+  // LMIC işleri (TX bitişi, RX açılışı/kapanışı) tam zamanında koşar
+  uint32_t stepMs = 100;
+  ostime_t next;
+  if (SimLmic::nextJobTime(next)) {
+    int32_t untilNext = osticks2ms(next - os_getTime());
+    stepMs = untilNext < 1 ? 1 : untilNext < 100 ? untilNext : 100;
+  }
+  SimClock::advanceMs(stepMs);
+}
+
+int main() {
+  CHECK(spscPreservesOrder(1000000));
+
+  beginSimulation();
+  lora.setup();
+  messages.setup(&lora);
+  lora.subscribe(LORA_EVENTS_TX_DONE, countCompleted, nullptr);
+  lora.subscribe(LORA_EVENTS_JOIN, onJoined, nullptr);
+  CHECK(RadioTask::start(&lora, radioService, nullptr));
+  CHECK(RadioTask::isRunning());
+  CHECK(!RadioTask::start(&lora, radioService, nullptr));
+
+  // UI tarafı: join'den sonra boyutu sıra numarasını taşıyan uplink'ler.
+  // Gelen kutusu doluysa bir sonraki turda yeniden denenir; gönderim kuyruğu
+  // taşıp en eskiyi atmasın diye en fazla UPLINK_QUEUE_CAPACITY istek yolda
+  const uint8_t uplinks = 12;
+  uint8_t posted = 0;
+  uint32_t inboxFull = 0;
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+  while (completed < uplinks && std::chrono::steady_clock::now() < deadline) {
+    if (joined && posted < uplinks && posted - completed < UPLINK_QUEUE_CAPACITY) {
+      uint8_t payload[16];
+      memset(payload, posted, sizeof(payload));
+      if (messages.postData(payload, posted + 1)) {
+        posted++;
+      } else {
+        inboxFull++;
+      }
+    }
+    lora.serviceUi();
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+  }
+
+  RadioTask::stop();
+  CHECK(!RadioTask::isRunning());
+  lora.serviceUi();
+
+  CHECK_EQ(posted, uplinks);
+  CHECK_EQ(completed.load(), uplinks);
+  CHECK(lora.isJoined());
+
+  // Veri uplink'leri gönderildiği sırada ve boyutta havaya çıktı
+  uint8_t seen = 0;
+  for (uint32_t i = 0; i < SimRadio::transmissionCount(); i++) {
+    const SimTransmission& tx = SimRadio::transmission(i);
+    if (tx.join) {
+      continue;
+    }
+    CHECK(seen < uplinks);
+    CHECK_EQ(tx.length, LORAWAN_FRAME_OVERHEAD + seen + 1);
+    seen++;
+  }
+  CHECK_EQ(seen, uplinks);
+
+  printf("RadioTask: %u uplink, gelen kutusu %lu kez dolu, sanal süre %lu ms\n",
+         seen, (unsigned long)inboxFull, (unsigned long)SimClock::nowMs());
+
+  return finishTest("test_radio_task");
+}
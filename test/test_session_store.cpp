@@ -0,0 +1,143 @@
+// Kalıcı oturum: yeniden açılışta OTAA join atlanır
+//
+// 1) İlk açılışta join yapılır ve birkaç uplink gönderilir; oturum ve
+//    sayaçlar SESSION_STORE_PATH önekli dosyalara yazılır.
+// 2) Yeni bir LoraManager aynı dosyalardan açılır: join isteği gitmeden
+//    bağlıdır, DevAddr/anahtarlar/kanallar aynıdır ve FCntUp son kayıttan
+//    SESSION_FCNT_SAVE_INTERVAL ileri atlar; hemen uplink gönderebilir.
+// 3) Oturum kaydı bozulursa yok sayılır ve cihaz join'e döner; DevNonce
+//    sayaç kaydından devam eder. REJOIN (forgetSession) da aynı yolu izler.
+
+#include <string.h>
+#include "HostTest.h"
+#include "../Core/Lora/LoraManager.h"
+
+static LoraManager firstBoot;
+static LoraManager secondBoot;
+static LoraManager thirdBoot;
+static LoraManager corruptedBoot;
+static LoraManager* lora = nullptr;
+static uint32_t completed = 0;
+
+static void step() {
+  lora->loop();
+}
+
+static void countTxDone(void* context, const LoraEvent& event) {
+  (void)event;
+  (*static_cast<uint32_t*>(context))++;
+}
+
+static bool sendAndWait(uint8_t size) {
+  uint8_t payload[16] = { 0 };
+  uint32_t before = completed;
+  runUntil(60000, step, [] { return !(LMIC.opmode & OP_TXRXPEND); });
+  if (!lora->sendData(payload, size, 1, false)) {
+    return false;
+  }
+  runUntil(60000, step, [&] { return completed != before; });
+  return completed != before;
+}
+
+static void boot(LoraManager& manager) {
+  lora = &manager;
+  lora->setup();
+  lora->subscribe(LORA_EVENTS_TX_DONE, countTxDone, &completed);
+}
+
+static FILE* openSessionFile(const char* mode) {
+  char path[128];
+  snprintf(path, sizeof(path), "%s.session", SESSION_STORE_PATH);
+  return fopen(path, mode);
+}
+
+static bool corruptSessionFile() {
+  FILE* file = openSessionFile("r+b");
+  if (!file) {
+    return false;
+  }
+  fseek(file, 12, SEEK_SET);
+  int value = fgetc(file);
+  fseek(file, 12, SEEK_SET);
+  fputc(value ^ 0xFF, file);
+  fclose(file);
+  return true;
+}
+
+int main() {
+  // ---- İlk açılış: join ve uplink'ler ----
+  beginSimulation();
+  boot(firstBoot);
+  runUntil(60000, step, [] { return lora->isJoined(); });
+  CHECK(lora->isJoined());
+  for (uint8_t i = 0; i < 5; i++) {
+    CHECK(sendAndWait(4));
+  }
+  runFor(1000, step);   // Kayıt TX/RX dışında yazılır
+
+  uint32_t devAddr = LMIC.devaddr;
+  uint8_t nwkSKey[16];
+  uint8_t appSKey[16];
+  memcpy(nwkSKey, LMIC.nwkKey, sizeof(nwkSKey));
+  memcpy(appSKey, LMIC.artKey, sizeof(appSKey));
+  uint32_t lastSeqnoUp = LMIC.seqnoUp;
+  uint16_t devNonce = LMIC.devNonce;
+  uint32_t channelFreq[MAX_CHANNELS];
+  memcpy(channelFreq, LMIC.channelFreq, sizeof(channelFreq));
+  CHECK_EQ(SimRadio::getStats().joinRequests, 1);
+  CHECK(lastSeqnoUp >= 5);
+
+  // ---- Yeniden açılış: kayıttan geri yükleme, join yok ----
+  beginSimulation(true);
+  boot(secondBoot);
+  CHECK(lora->isJoined());
+  CHECK_EQ(LMIC.devaddr, devAddr);
+  CHECK(memcmp(LMIC.nwkKey, nwkSKey, sizeof(nwkSKey)) == 0);
+  CHECK(memcmp(LMIC.artKey, appSKey, sizeof(appSKey)) == 0);
+  CHECK(memcmp(LMIC.channelFreq, channelFreq, sizeof(channelFreq)) == 0);
+  CHECK(LMIC.seqnoUp > lastSeqnoUp);
+  CHECK(LMIC.seqnoUp <= lastSeqnoUp + SESSION_FCNT_SAVE_INTERVAL);
+  uint32_t restoredSeqnoUp = LMIC.seqnoUp;
+
+  CHECK(sendAndWait(4));
+  CHECK_EQ(SimRadio::getStats().joinRequests, 0);
+  CHECK_EQ(SimRadio::transmission(0).join, false);
+  runFor(1000, step);
+
+  // Art arda açılışta FCnt ileri gitmeye devam eder (tekrar eden FCnt yok)
+  beginSimulation(true);
+  boot(thirdBoot);
+  CHECK(lora->isJoined());
+  CHECK(LMIC.seqnoUp > restoredSeqnoUp);
+  CHECK_EQ(SimRadio::getStats().joinRequests, 0);
+
+  // ---- Bozuk oturum kaydı: join'e dönülür, DevNonce kayıttan devam eder ----
+  CHECK(corruptSessionFile());
+  beginSimulation(true);
+  boot(corruptedBoot);
+  CHECK(!lora->isJoined());
+  runUntil(60000, step, [] { return lora->isJoined(); });
+  CHECK(lora->isJoined());
+  CHECK_EQ(SimRadio::getStats().joinRequests, 1);
+  CHECK(LMIC.devNonce > devNonce);
+
+  // ---- REJOIN: oturum silinir, yeni DevNonce ile join ----
+  uint16_t nonceBeforeRejoin = LMIC.devNonce;
+  lora->forgetSession();
+  runUntil(1000, step, [] { return !lora->isJoined(); });   // İstek loop() içinde işlenir
+  CHECK(!lora->isJoined());
+  FILE* file = openSessionFile("rb");
+  CHECK(file == nullptr);
+  if (file) {
+    fclose(file);
+  }
+  runUntil(60000, step, [] { return lora->isJoined(); });
+  CHECK(lora->isJoined());
+  CHECK_EQ(SimRadio::getStats().joinRequests, 2);
+  CHECK(LMIC.devNonce > nonceBeforeRejoin);
+
+  printf("Geri yüklenen FCntUp %lu (son kullanılan %lu), join atlandı\n",
+         (unsigned long)restoredSeqnoUp, (unsigned long)lastSeqnoUp);
+
+  return finishTest("test_session_store");
+}
@@ -0,0 +1,134 @@
+// Simüle edilmiş radyo üzerinde OTAA join ve uplink/downlink akışı
+//
+// LoraManager gerçek koduyla, host LMIC modeli ve sanal saat üzerinde
+// koşar: join-accept RX1'de gelir, ardından onaysız ve onaylı uplink'ler,
+// RX1/RX2 downlink'leri ve RX zamanlama kalibrasyonu denetlenir.
+
+#include "HostTest.h"
+#include "../Core/Lora/LoraManager.h"
+
+struct TxLog {
+  uint32_t completed;
+  LoraEvent last;
+  uint8_t downlinkPort;
+  uint8_t downlinkLen;
+  uint8_t downlink[32];
+  uint32_t downlinks;
+};
+
+static void onTxDone(void* context, const LoraEvent& event) {
+  TxLog* log = static_cast<TxLog*>(context);
+  log->completed++;
+  log->last = event;
+}
+
+static void onDownlink(void* context, uint8_t port, PayloadView payload) {
+  TxLog* log = static_cast<TxLog*>(context);
+  log->downlinks++;
+  log->downlinkPort = port;
+  log->downlinkLen = payload.size();
+  memcpy(log->downlink, payload.data(), payload.size() < sizeof(log->downlink) ? payload.size() : sizeof(log->downlink));
+}
+
+static LoraManager lora;
+static TxLog txLog;
+
+static void step() {
+  lora.loop();
+}
+
+// Uplink'i gönder ve EV_TXCOMPLETE'i bekle (bant izni dahil en fazla 60 sn)
+static bool sendAndWait(uint8_t* data, uint8_t size, uint8_t port, bool confirmed) {
+  uint32_t before = txLog.completed;
+  if (!lora.sendData(data, size, port, confirmed)) {
+    return false;
+  }
+  runUntil(60000, step, [&] { return txLog.completed != before; });
+  return txLog.completed != before;
+}
+
+int main() {
+  beginSimulation();
+  memset(&txLog, 0, sizeof(txLog));
+
+  lora.setup();
+  lora.subscribe(LORA_EVENTS_TX_DONE, onTxDone, &txLog);
+  lora.setDownlinkHandler(onDownlink, &txLog);
+
+  // ---- Join: ilk istek RX1'de kabul edilir (JOIN_ACCEPT_DELAY1 = 5 sn) ----
+  uint32_t joinMs = runUntil(60000, step, [] { return lora.isJoined(); });
+  CHECK(lora.isJoined());
+  CHECK(joinMs >= 5000 && joinMs < 6000);
+  CHECK_EQ(SimRadio::getStats().joinRequests, 1);
+  CHECK_EQ(SimRadio::transmission(0).length, 23);
+  CHECK_EQ(SimRadio::transmission(0).datarate, RADIO_PROFILE_DATARATE);
+  CHECK_EQ(LMIC.devaddr, SimRadio::defaultJoinAccept().devAddr);
+  CHECK_EQ(LMIC.devNonce, 1);
+  CHECK(Region::validate());
+
+  // ---- Onaysız uplink, downlink yok ----
+  uint8_t payload[10] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+  CHECK(sendAndWait(payload, sizeof(payload), 1, false));
+  CHECK(txLog.last.success);
+  CHECK_EQ(txLog.last.txrxFlags & (TXRX_DNW1 | TXRX_DNW2), 0);
+  CHECK_EQ(SimRadio::transmissionCount(), 2);
+  CHECK_EQ(SimRadio::transmission(1).length, LORAWAN_FRAME_OVERHEAD + sizeof(payload));
+  CHECK_EQ(SimRadio::transmission(1).port, 1);
+  CHECK_EQ(LMIC.seqnoUp, 1);
+
+  // Bant %1 görev döngüsünde: sonraki iletim yayın süresinin 100 katı sonra başlar
+  uint64_t firstStart = SimRadio::transmission(1).startUs;
+  uint32_t firstAir = SimRadio::transmission(1).airtimeUs;
+
+  // ---- RX1'de FPort'lu downlink ----
+  const uint8_t command[3] = { 0xA1, 0xB2, 0xC3 };
+  CHECK(SimRadio::queueDownlink(10, command, sizeof(command), 1));
+  CHECK(sendAndWait(payload, 4, 1, false));
+  CHECK(SimRadio::transmission(2).startUs - firstStart >= (uint64_t)firstAir * 100);
+  CHECK_EQ(txLog.downlinks, 1);
+  CHECK_EQ(txLog.downlinkPort, 10);
+  CHECK_EQ(txLog.downlinkLen, 3);
+  CHECK(memcmp(txLog.downlink, command, 3) == 0);
+  CHECK(txLog.last.txrxFlags & TXRX_DNW1);
+  CHECK_EQ(LMIC.seqnoDn, 1);
+
+  // ---- Onaylı uplink: ACK RX1'de ----
+  CHECK(sendAndWait(payload, 4, 1, true));
+  CHECK(txLog.last.txrxFlags & TXRX_ACK);
+  CHECK_EQ(txLog.downlinks, 1);
+
+  // ---- RX2'de downlink ----
+  CHECK(SimRadio::queueDownlink(11, command, 2, 2));
+  CHECK(sendAndWait(payload, 4, 1, false));
+  CHECK(txLog.last.txrxFlags & TXRX_DNW2);
+  CHECK_EQ(txLog.downlinks, 2);
+  CHECK_EQ(txLog.downlinkPort, 11);
+
+  // ---- Onaylı uplink, ağ ACK vermiyor ----
+  SimRadio::setAckConfirmed(false);
+  CHECK(sendAndWait(payload, 4, 1, true));
+  CHECK(txLog.last.txrxFlags & TXRX_NACK);
+  SimRadio::setAckConfirmed(true);
+
+  // ---- Saat hatası: downlink 3 ms geç gelir, kalibrasyon sapmayı ölçer ----
+  SimRadio::setTimingOffsetUs(3000);
+  for (int i = 0; i < 4; i++) {
+    CHECK(sendAndWait(payload, 4, 1, true));
+    CHECK(txLog.last.txrxFlags & TXRX_ACK);
+  }
+  const RxCalibrationStats& cal = lora.getRxCalibration().getStats();
+  CHECK(cal.calibrated);
+  CHECK(cal.lastOffsetUs > 2900 && cal.lastOffsetUs < 3100);
+
+  // Kalibre pencere varsayılandan dar: rxsyms azalır
+  CHECK(LMIC.rxsyms < 32);
+  CHECK_EQ(SimRadio::getStats().missedDownlinks, 0);
+
+  printf("join %lu ms, %lu iletim, %lu RX penceresi, alıcı açık %lu ms\n",
+         (unsigned long)joinMs,
+         (unsigned long)SimRadio::getStats().transmissions,
+         (unsigned long)SimRadio::getStats().rxWindows,
+         (unsigned long)(SimRadio::getStats().rxOnUs / 1000));
+
+  return finishTest("test_sim_join");
+}
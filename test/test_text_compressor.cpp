@@ -0,0 +1,82 @@
+// TextCompressor: örnek mesaj derlemi üzerinde oran, gidiş-dönüş ve hız
+//
+// Derlem cihazın gönderdiği tipik durum/alarm metinleridir (saha kaydı değil).
+// Sıkıştırılan her çerçeve açılıp özgün metinle karşılaştırılır; kazanç
+// olmayan metin için compress() 0 döndürmeli ve metin olduğu gibi gitmelidir.
+
+#include "HostTest.h"
+#include <chrono>
+#include "../Features/Encoding/TextCompressor.h"
+
+static const char* const kCorpus[] = {
+  "Hello World", "ALARM: Sicaklik yuksek 41.5", "Batarya dusuk: %12", "Kapi acildi",
+  "Kapi kapandi", "Durum: NORMAL, Batarya 3.71V", "Sensor hatasi #3", "UYARI: Nem yuksek 87%",
+  "Baglanti kesildi", "Aga katildi", "Veri gonderildi, ACK alindi", "status OK",
+  "error: sensor timeout", "Temp 22.4, battery 3.9V", "Cihaz yeniden basladi",
+  "Basinc normal 1013 hPa", "Seviye DUSUK", "RESET: watchdog", "door open", "Voltaj dusuk 3.2V",
+};
+static const uint8_t kCorpusSize = sizeof(kCorpus) / sizeof(kCorpus[0]);
+static const uint32_t kRounds = 20000;
+
+int main() {
+  uint8_t frames[kCorpusSize][64];
+  uint8_t lengths[kCorpusSize];
+  char text[128];
+  uint32_t rawBytes = 0;
+  uint32_t sentBytes = 0;
+
+  // ---- Oran ve gidiş-dönüş ----
+  for (uint8_t i = 0; i < kCorpusSize; i++) {
+    uint8_t length = strlen(kCorpus[i]);
+    lengths[i] = TextCompressor::compress(kCorpus[i], length, frames[i], sizeof(frames[i]));
+    rawBytes += length;
+    sentBytes += lengths[i] ? lengths[i] : length;
+
+    if (lengths[i]) {
+      CHECK(lengths[i] < length);
+      CHECK(TextCompressor::isCompressed(frames[i], lengths[i]));
+      int16_t decoded = TextCompressor::decompress(frames[i], lengths[i], text, sizeof(text));
+      CHECK_EQ(decoded, length);
+      CHECK(decoded == length && memcmp(text, kCorpus[i], length) == 0);
+    }
+  }
+  double ratio = (double)rawBytes / sentBytes;
+  CHECK(ratio > 1.5);
+
+  // Sözlükte karşılığı olmayan ve ASCII dışı metin sıkıştırılmaz
+  uint8_t frame[64];
+  CHECK_EQ(TextCompressor::compress("xyz", 3, frame, sizeof(frame)), 0);
+  CHECK_EQ(TextCompressor::compress("S\xc4\xb1" "cak", 6, frame, sizeof(frame)), 0);
+
+  // Bozuk çerçeve reddedilir
+  const uint8_t badVersion[] = { 0x80 | (TEXT_DICTIONARY_VERSION + 1), 'a' };
+  CHECK_EQ(TextCompressor::decompress(badVersion, sizeof(badVersion), text, sizeof(text)), -1);
+  const uint8_t badIndex[] = { TEXT_COMPRESSED_MARKER, 0xFF };
+  CHECK_EQ(TextCompressor::decompress(badIndex, sizeof(badIndex), text, sizeof(text)), -1);
+
+  // ---- Hız ----
+  volatile uint32_t sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t r = 0; r < kRounds; r++) {
+    for (uint8_t i = 0; i < kCorpusSize; i++) {
+      sink = sink + TextCompressor::compress(kCorpus[i], strlen(kCorpus[i]), frame, sizeof(frame));
+    }
+  }
+  auto middle = std::chrono::steady_clock::now();
+  for (uint32_t r = 0; r < kRounds; r++) {
+    for (uint8_t i = 0; i < kCorpusSize; i++) {
+      if (lengths[i]) {
+        sink = sink + TextCompressor::decompress(frames[i], lengths[i], text, sizeof(text));
+      }
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  double messages = (double)kRounds * kCorpusSize;
+  double encodeNs = std::chrono::duration<double, std::nano>(middle - start).count() / messages;
+  double decodeNs = std::chrono::duration<double, std::nano>(end - middle).count() / messages;
+
+  printf("%u mesaj, %lu -> %lu byte (oran %.2f), sıkıştırma %.0f ns/mesaj, açma %.0f ns/mesaj\n",
+         kCorpusSize, (unsigned long)rawBytes, (unsigned long)sentBytes, ratio, encodeNs, decodeNs);
+
+  return finishTest("test_text_compressor");
+}
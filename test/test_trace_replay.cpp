@@ -0,0 +1,92 @@
+// TRACE_DUMP kaydının simüle radyoya geri oynatılması
+//
+// Önce betiklenmiş bir ağla join ve farklı sonuçlu uplink'ler (yanıtsız,
+// RX1/RX2 downlink, ACK, NACK) koşturulup iz dökülür. Döküm SimTrace ile
+// okunur, ağ yanıtları SimRadio'ya betiklenir ve aynı uplink'ler yeni bir
+// LoraManager ile yeniden oynatılır; iki izin uplink sonuçları aynı olmalıdır.
+
+#include "HostTest.h"
+#include "TraceReplay.h"
+
+static LoraManager recorder;
+static LoraManager player;
+static uint32_t completed = 0;
+
+static void step() {
+  recorder.loop();
+}
+
+static bool sendAndWait(uint8_t size, bool confirmed) {
+  uint8_t payload[16] = { 0 };
+  uint32_t before = completed;
+  if (!recorder.sendData(payload, size, 1, confirmed)) {
+    return false;
+  }
+  runUntil(60000, step, [&] { return completed != before; });
+  return completed != before;
+}
+
+int main() {
+  // ---- Kayıt: join RX2'de ikinci istekte, ardından beş farklı sonuç ----
+  beginSimulation();
+  SimJoinAccept accept = SimRadio::defaultJoinAccept();
+  accept.attempt = 2;
+  accept.window = 2;
+  SimRadio::scriptJoinAccept(accept);
+
+  recorder.setup();
+  recorder.subscribe(LORA_EVENTS_TX_DONE, countTxDone, &completed);
+  runUntil(60000, step, [] { return recorder.isJoined(); });
+  CHECK(recorder.isJoined());
+
+  const uint8_t command[3] = { 1, 2, 3 };
+  CHECK(sendAndWait(4, false));
+  CHECK(SimRadio::queueDownlink(10, command, sizeof(command), 1));
+  CHECK(sendAndWait(6, false));
+  CHECK(sendAndWait(2, true));
+  CHECK(SimRadio::queueDownlink(11, command, 2, 2));
+  CHECK(sendAndWait(8, false));
+  SimRadio::setAckConfirmed(false);
+  CHECK(sendAndWait(3, true));
+
+  BufferPrint dump;
+  dump.write((const uint8_t*)"TRACE_DUMP\r\n", 12);   // Seri kayıtta döküm öncesi metin
+  recorder.getEventTrace().dump(dump);
+
+  SimTrace recorded;
+  CHECK(recorded.load(dump.data.data(), dump.data.size()));
+  CHECK_EQ(recorded.getHeader().overwritten, 0);
+  CHECK_EQ(recorded.uplinkCount(), 7);
+  CHECK(recorded.uplink(0).join && recorded.uplink(0).result == EV_JOIN_TXCOMPLETE);
+  CHECK(recorded.uplink(1).join && recorded.uplink(1).result == EV_JOINED);
+  CHECK_EQ(recorded.uplink(1).window, 2);
+  CHECK_EQ(recorded.uplink(2).window, 0);
+  CHECK_EQ(recorded.uplink(3).window, 1);
+  CHECK_EQ(recorded.uplink(3).downlinkLen, 3);
+  CHECK(recorded.uplink(4).txrxFlags & TXRX_ACK);
+  CHECK_EQ(recorded.uplink(5).window, 2);
+  CHECK(recorded.uplink(6).txrxFlags & TXRX_NACK);
+  CHECK_EQ(recorded.uplink(6).length, LORAWAN_FRAME_OVERHEAD + 3);
+
+  // ---- Oynatma: varsayılan ağ betiği yerine kayıttaki yanıtlar ----
+  beginSimulation();
+  SimTrace replayed;
+  CHECK_EQ(replayTrace(recorded, player, replayed), 5);
+  CHECK_EQ(SimRadio::getStats().joinRequests, 2);
+  CHECK_EQ(SimRadio::pendingDownlinks(), 0);
+  CHECK_EQ(recorded.firstMismatch(replayed), -1);
+
+  // Uplink'ler kayıttaki zamanlarda gider (görev döngüsü beklemesi dahil)
+  for (uint16_t i = 0; i < replayed.uplinkCount(); i++) {
+    int32_t drift = (int32_t)(replayed.uplink(i).atMs - recorded.uplink(i).atMs);
+    CHECK(drift >= -5 && drift <= 5);
+  }
+
+  // Eksik uplink fark olarak bulunur
+  SimTrace empty;
+  CHECK_EQ(recorded.firstMismatch(empty), 0);
+
+  printf("%u uplink kaydedildi ve oynatıldı\n", recorded.uplinkCount());
+
+  return finishTest("test_trace_replay");
+}
@@ -0,0 +1,143 @@
+// UplinkAggregator: çerçeve sınırı küçüldüğünde bekleyen kayıtların bölünmesi
+//
+// Veri hızı düştüğünde birikmiş çerçeve yeni sınırı aşar. Kayıtlar sığan
+// çerçevelere bölünmeli, tek başına sığmayan kayıt atılıp sayılmalı ve
+// gönderim hedefi reddettiğinde kayıtlar kaybolmamalıdır.
+
+#include "HostTest.h"
+#include "../Features/Messaging/UplinkAggregator.h"
+
+struct FlushLog {
+  bool accept;
+  uint8_t frames;
+  uint8_t records;
+  uint8_t maxSize;
+  uint8_t lastType;
+  bool ordered;
+};
+
+// Çerçeveyi çözümler; kayıt tipleri artan sırada gelmelidir
+static bool onFlush(void* context, uint8_t* frame, uint8_t size) {
+  FlushLog* log = static_cast<FlushLog*>(context);
+  if (!log->accept) {
+    return false;
+  }
+  uint8_t pos = AGGREGATE_HEADER_SIZE;
+  for (uint8_t i = 0; i < frame[1]; i++) {
+    if (log->records && frame[pos] <= log->lastType) {
+      log->ordered = false;
+    }
+    log->lastType = frame[pos];
+    pos += AGGREGATE_RECORD_HEADER + frame[pos + 1];
+    log->records++;
+  }
+  if (pos != size) {
+    log->ordered = false;
+  }
+  if (size > log->maxSize) {
+    log->maxSize = size;
+  }
+  log->frames++;
+  return true;
+}
+
+static void resetLog(FlushLog& log) {
+  memset(&log, 0, sizeof(log));
+  log.accept = true;
+  log.ordered = true;
+}
+
+int main() {
+  beginSimulation();
+  uint8_t data[32];
+  memset(data, 0xAB, sizeof(data));
+  FlushLog log;
+
+  // ---- 51 byte'ta birikmiş 4 kayıt, sınır 30'a düşer ----
+  resetLog(log);
+  UplinkAggregator aggregator;
+  aggregator.setFlushCallback(onFlush, &log);
+  aggregator.setMaxFrameSize(51);
+  for (uint8_t i = 1; i <= 4; i++) {
+    CHECK(aggregator.addRecord(i, data, 10));
+  }
+  CHECK_EQ(aggregator.pendingBytes(), 50);
+  CHECK_EQ(log.frames, 0);
+
+  aggregator.setMaxFrameSize(30);
+  CHECK_EQ(log.frames, 2);
+  CHECK_EQ(log.records, 4);
+  CHECK(log.maxSize <= 30);
+  CHECK(log.ordered);
+  CHECK_EQ(aggregator.pendingRecords(), 0);
+  CHECK_EQ(aggregator.getFrameCount(), 2);
+  CHECK_EQ(aggregator.getDroppedCount(), 0);
+
+  // ---- Tek başına sığmayan kayıt atılır ve sayılır ----
+  resetLog(log);
+  aggregator.setMaxFrameSize(100);
+  CHECK(aggregator.addRecord(10, data, 20));
+  CHECK(aggregator.addRecord(11, data, 5));
+  CHECK(aggregator.addRecord(12, data, 30));
+  CHECK(aggregator.addRecord(13, data, 1));
+  aggregator.setMaxFrameSize(11);
+  CHECK_EQ(aggregator.getDroppedCount(), 2);
+  CHECK_EQ(log.records, 2);
+  CHECK(log.maxSize <= 11);
+  CHECK(log.ordered);
+  CHECK_EQ(aggregator.pendingRecords(), 0);
+
+  // Yeni sınırla kayıt eklemeye devam edilebilir
+  CHECK(aggregator.addRecord(14, data, 4));
+  CHECK(!aggregator.addRecord(15, data, 10));
+
+  // ---- Hedef reddederken kayıtlar korunur, sonra bölünerek gönderilir ----
+  resetLog(log);
+  UplinkAggregator pending;
+  pending.setFlushCallback(onFlush, &log);
+  pending.setMaxFrameSize(100);
+  for (uint8_t i = 1; i <= 6; i++) {
+    CHECK(pending.addRecord(i, data, 12));
+  }
+  log.accept = false;
+  pending.setMaxFrameSize(35);
+  CHECK_EQ(pending.pendingRecords(), 6);
+  CHECK(!pending.flush());
+
+  // Sınır aşılmış durumdayken de ekleme, önce bölünmüş gönderimi dener
+  CHECK(!pending.addRecord(7, data, 2));
+  CHECK_EQ(pending.pendingRecords(), 6);
+
+  log.accept = true;
+  CHECK(pending.addRecord(7, data, 2));
+  CHECK_EQ(log.frames, 3);
+  CHECK_EQ(log.records, 6);
+  CHECK(log.maxSize <= 35);
+  CHECK_EQ(pending.pendingRecords(), 1);
+  CHECK(pending.flush());
+  CHECK_EQ(log.records, 7);
+  CHECK(log.ordered);
+  CHECK_EQ(pending.getDroppedCount(), 0);
+
+  // ---- Gecikme eşiği: bölünme sonrası kalan kayıtlar yine süreyle gönderilir ----
+  resetLog(log);
+  log.accept = false;
+  pending.setThresholds(UPLINK_SLOT_SIZE, 1000);
+  pending.setMaxFrameSize(100);
+  for (uint8_t i = 20; i < 24; i++) {
+    CHECK(pending.addRecord(i, data, 12));
+  }
+  pending.setMaxFrameSize(20);
+  log.accept = true;
+  runFor(999, [&] { pending.loop(); });
+  CHECK_EQ(log.frames, 0);
+  runFor(2, [&] { pending.loop(); });
+  CHECK_EQ(log.frames, 4);
+  CHECK_EQ(pending.pendingRecords(), 0);
+
+  printf("bölünen çerçeve %lu, atılan kayıt %lu\n",
+         (unsigned long)(aggregator.getFrameCount() + pending.getFrameCount()),
+         (unsigned long)(aggregator.getDroppedCount() + pending.getDroppedCount()));
+
+  return finishTest("test_uplink_aggregator");
+}
@@ -0,0 +1,192 @@
+// UplinkQueue: öncelik sırası, taşma politikaları, son teslim zamanı
+//
+// Kuyruk dolduğunda DROP_OLDEST en eskiyi, DROP_LOWEST_PRIORITY en düşük
+// öncelikli (eşitse en eski) mesajı atar, DROP_REJECT yeni mesajı reddeder;
+// her yol kendi sayacına yazılmalıdır. Süresi geçen mesajlar peek()/push()
+// sırasında atılır. requeue() sonucu gelmeyen mesajı sıra numarasıyla geri koyar.
+
+#include "HostTest.h"
+#include "../Features/Messaging/UplinkQueue.h"
+
+// Her mesajın ilk byte'ı kimliğidir
+static bool pushId(UplinkQueue& queue, uint8_t id, uint8_t priority, uint32_t deadlineMs = 0) {
+  uint8_t data[4] = { id, 0, 0, 0 };
+  return queue.push(data, sizeof(data), 1, priority, deadlineMs, priority >= PRIORITY_CRITICAL);
+}
+
+// Kuyruğu gönderim sırasıyla boşaltır; kimlikleri ids'e yazar
+static uint8_t drain(UplinkQueue& queue, uint8_t* ids) {
+  uint8_t n = 0;
+  while (const UplinkMessage* next = queue.peek()) {
+    ids[n++] = next->data[0];
+    queue.pop();
+  }
+  return n;
+}
+
+static bool sameOrder(const uint8_t* ids, uint8_t n, const uint8_t* expected, uint8_t expectedCount) {
+  return n == expectedCount && memcmp(ids, expected, n) == 0;
+}
+
+static void fill(UplinkQueue& queue, const uint8_t* priorities) {
+  for (uint8_t i = 0; i < UPLINK_QUEUE_CAPACITY; i++) {
+    CHECK(pushId(queue, i, priorities[i]));
+  }
+  CHECK_EQ(queue.depth(), UPLINK_QUEUE_CAPACITY);
+}
+
+int main() {
+  beginSimulation();
+  uint8_t ids[UPLINK_QUEUE_CAPACITY + 1];
+
+  // Testler 8 yuvalık kuyruğa göre yazıldı
+  static_assert(UPLINK_QUEUE_CAPACITY == 8, "beklenen sıralar UPLINK_QUEUE_CAPACITY 8 içindir");
+  static const uint8_t mixed[UPLINK_QUEUE_CAPACITY] = {
+    PRIORITY_LOW, PRIORITY_HIGH, PRIORITY_NORMAL, PRIORITY_LOW,
+    PRIORITY_CRITICAL, PRIORITY_NORMAL, PRIORITY_HIGH, PRIORITY_LOW
+  };
+
+  // ---- Öncelik sırası: yüksek önce, eşitse FIFO ----
+  {
+    UplinkQueue queue;
+    fill(queue, mixed);
+    static const uint8_t expected[] = { 4, 1, 6, 2, 5, 0, 3, 7 };
+    CHECK(sameOrder(ids, drain(queue, ids), expected, sizeof(expected)));
+    CHECK(queue.isEmpty());
+    CHECK_EQ(queue.getStats().sent, UPLINK_QUEUE_CAPACITY);
+    CHECK_EQ(queue.getStats().maxDepth, UPLINK_QUEUE_CAPACITY);
+    CHECK_EQ(queue.getStats().depth, 0);
+  }
+
+  // ---- DROP_OLDEST: önceliğe bakmadan en eski atılır ----
+  {
+    UplinkQueue queue;
+    queue.setDropPolicy(DROP_OLDEST);
+    fill(queue, mixed);
+    CHECK(pushId(queue, 8, PRIORITY_LOW));
+    CHECK(pushId(queue, 9, PRIORITY_LOW));
+    CHECK_EQ(queue.getStats().droppedOverflow, 2);
+    CHECK_EQ(queue.getStats().rejected, 0);
+    CHECK_EQ(queue.getStats().enqueued, UPLINK_QUEUE_CAPACITY + 2);
+    static const uint8_t expected[] = { 4, 6, 2, 5, 3, 7, 8, 9 };   // 0 ve 1 atıldı
+    CHECK(sameOrder(ids, drain(queue, ids), expected, sizeof(expected)));
+  }
+
+  // ---- DROP_LOWEST_PRIORITY: en düşük öncelikli en eski atılır ----
+  {
+    UplinkQueue queue;
+    CHECK_EQ(queue.getDropPolicy(), DROP_LOWEST_PRIORITY);
+    fill(queue, mixed);
+    CHECK(pushId(queue, 8, PRIORITY_NORMAL));   // 0 (LOW, en eski) atılır
+    CHECK(pushId(queue, 9, PRIORITY_LOW));      // Eşit öncelik: 3 atılır
+    CHECK_EQ(queue.getStats().droppedOverflow, 2);
+    static const uint8_t expected[] = { 4, 1, 6, 2, 5, 8, 7, 9 };
+    CHECK(sameOrder(ids, drain(queue, ids), expected, sizeof(expected)));
+
+    // Tüm yuvalar daha önemliyse düşük öncelikli yeni mesaj reddedilir
+    static const uint8_t important[UPLINK_QUEUE_CAPACITY] = {
+      PRIORITY_NORMAL, PRIORITY_HIGH, PRIORITY_NORMAL, PRIORITY_HIGH,
+      PRIORITY_CRITICAL, PRIORITY_NORMAL, PRIORITY_HIGH, PRIORITY_NORMAL
+    };
+    fill(queue, important);
+    CHECK(!pushId(queue, 8, PRIORITY_LOW));
+    CHECK_EQ(queue.getStats().rejected, 1);
+    CHECK_EQ(queue.getStats().droppedOverflow, 2);
+    CHECK(pushId(queue, 9, PRIORITY_CRITICAL));  // 0 (NORMAL, en eski) atılır
+    CHECK_EQ(queue.getStats().droppedOverflow, 3);
+    static const uint8_t expectedImportant[] = { 4, 9, 1, 3, 6, 2, 5, 7 };
+    CHECK(sameOrder(ids, drain(queue, ids), expectedImportant, sizeof(expectedImportant)));
+  }
+
+  // ---- DROP_REJECT: kuyruk değişmez ----
+  {
+    UplinkQueue queue;
+    queue.setDropPolicy(DROP_REJECT);
+    fill(queue, mixed);
+    CHECK(!pushId(queue, 8, PRIORITY_CRITICAL));
+    CHECK(!pushId(queue, 9, PRIORITY_LOW));
+    CHECK_EQ(queue.getStats().rejected, 2);
+    CHECK_EQ(queue.getStats().droppedOverflow, 0);
+    CHECK_EQ(queue.getStats().enqueued, UPLINK_QUEUE_CAPACITY);
+    static const uint8_t expected[] = { 4, 1, 6, 2, 5, 0, 3, 7 };
+    CHECK(sameOrder(ids, drain(queue, ids), expected, sizeof(expected)));
+  }
+
+  // ---- Geçersiz boyut ----
+  {
+    UplinkQueue queue;
+    uint8_t data[1] = { 0 };
+    CHECK(!queue.push(data, 0, 1, PRIORITY_NORMAL, 0, false));
+    CHECK(!queue.push(nullptr, 1, 1, PRIORITY_NORMAL, 0, false));
+    CHECK_EQ(queue.getStats().rejected, 2);
+    CHECK(queue.isEmpty());
+  }
+
+  // ---- Son teslim zamanı: süresi geçen mesaj atılır, sınır dahil kalır ----
+  {
+    UplinkQueue queue;
+    CHECK(pushId(queue, 0, PRIORITY_HIGH, 100));
+    CHECK(pushId(queue, 1, PRIORITY_LOW, 500));
+    CHECK(pushId(queue, 2, PRIORITY_LOW));
+    SimClock::advanceMs(100);
+    CHECK(queue.peek() && queue.peek()->data[0] == 0);
+    SimClock::advanceMs(1);
+    const UplinkMessage* next = queue.peek();
+    CHECK(next && next->data[0] == 1);
+    CHECK_EQ(queue.getStats().droppedExpired, 1);
+    CHECK_EQ(queue.depth(), 2);
+
+    // Kuyruk dolu olsa bile süresi geçmiş mesajın yeri push sırasında açılır
+    queue.setDropPolicy(DROP_REJECT);
+    for (uint8_t i = 3; queue.depth() < UPLINK_QUEUE_CAPACITY; i++) {
+      CHECK(pushId(queue, i, PRIORITY_NORMAL));
+    }
+    SimClock::advanceMs(400);
+    CHECK(pushId(queue, 20, PRIORITY_NORMAL));
+    CHECK_EQ(queue.getStats().droppedExpired, 2);
+    CHECK_EQ(queue.getStats().rejected, 0);
+  }
+
+  // ---- discard ve requeue ----
+  {
+    UplinkQueue queue;
+    CHECK(pushId(queue, 0, PRIORITY_NORMAL, 1000));
+    CHECK(pushId(queue, 1, PRIORITY_NORMAL));
+    CHECK(pushId(queue, 2, PRIORITY_NORMAL));
+
+    // Veri hızı düşünce sığmayan mesaj
+    CHECK(queue.peek()->data[0] == 0);
+    queue.discard();
+    CHECK_EQ(queue.getStats().droppedOversize, 1);
+
+    // LMIC'e teslim edilen mesaj sonucu gelmeden geri konur: yine başta
+    UplinkMessage inFlight = *queue.peek();
+    queue.pop();
+    CHECK(pushId(queue, 3, PRIORITY_NORMAL));
+    CHECK(queue.requeue(inFlight));
+    CHECK_EQ(queue.getStats().requeued, 1);
+    static const uint8_t expected[] = { 1, 2, 3 };
+    CHECK(sameOrder(ids, drain(queue, ids), expected, sizeof(expected)));
+
+    // Kuyruk doluysa geri konamaz ve sayılır
+    queue.setDropPolicy(DROP_OLDEST);
+    CHECK(pushId(queue, 0, PRIORITY_NORMAL, 1000));
+    inFlight = *queue.peek();
+    queue.pop();
+    for (uint8_t i = 1; i <= UPLINK_QUEUE_CAPACITY; i++) {
+      CHECK(pushId(queue, i, PRIORITY_LOW));
+    }
+    CHECK(!queue.requeue(inFlight));
+    CHECK_EQ(queue.getStats().droppedInFlight, 1);
+    CHECK_EQ(queue.getStats().droppedOverflow, 0);
+
+    // Süresi geçmiş mesaj geri konmaz
+    drain(queue, ids);
+    SimClock::advanceMs(1001);
+    CHECK(!queue.requeue(inFlight));
+    CHECK_EQ(queue.getStats().droppedInFlight, 2);
+    CHECK(queue.isEmpty());
+  }
+
+  return finishTest("test_uplink_queue");
+}
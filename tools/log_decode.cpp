@@ -0,0 +1,75 @@
+// LogRing ikili çıktısını okunur metne çeviren host aracı
+//
+// Derleme:   g++ -std=c++11 -O2 -o log_decode tools/log_decode.cpp
+// Kullanım:  ./log_decode < seri_kayit.bin
+//            ./log_decode seri_kayit.bin
+//
+// Girdi, LOG_OUTPUT_BINARY 1 ile derlenmiş cihazın seri çıktısıdır: her kayıt
+// LOG_SYNC_BYTE ile başlar ve ardından LogRecord yapısı (küçük endian, 24 byte)
+// gelir. Eşitleme kaybolursa (ör. araya metin karışırsa) araç bir sonraki
+// geçerli kayda kadar byte byte ilerler.
+
+#include <stdio.h>
+#include <string.h>
+#include "../Core/Utils/LogEvents.h"
+
+// Eşitleme byte'ından sonraki 24 byte gerçek bir kayıt olabilir mi
+static bool isValidRecord(const LogRecord& record) {
+  if (record.id >= LOG_EVENT_COUNT || record.reserved != 0) {
+    return false;
+  }
+  // Ham byte kayıtları en az bir byte taşır (LogRing::pushBytes)
+  if (kLogFormats[record.id].rawBytes) {
+    return record.argc > 0 && record.argc <= sizeof(record.bytes);
+  }
+  return record.argc <= LOG_RECORD_ARGS;
+}
+
+int main(int argc, char** argv) {
+  FILE* in = stdin;
+  if (argc > 1) {
+    in = fopen(argv[1], "rb");
+    if (!in) {
+      perror(argv[1]);
+      return 1;
+    }
+  }
+  
+  unsigned long records = 0;
+  unsigned long skipped = 0;
+  
+  // Kayan pencere: eşitleme byte'ı + kayıt. Yükün içindeki bir 0xA5 yanlış
+  // eşitleme verirse yalnızca o byte atlanır ve tarama bir sonraki byte'tan
+  // sürer; böylece pencerenin içindeki gerçek eşitleme byte'ı yutulmaz.
+  uint8_t window[1 + sizeof(LogRecord)];
+  size_t filled = 0;
+  
+  for (;;) {
+    filled += fread(window + filled, 1, sizeof(window) - filled, in);
+    if (filled < sizeof(window)) {
+      skipped += filled;
+      break;
+    }
+    
+    LogRecord record;
+    memcpy(&record, window + 1, sizeof(record));
+    if (window[0] == LOG_SYNC_BYTE && isValidRecord(record)) {
+      char line[256];
+      formatLogRecord(record, line, sizeof(line));
+      puts(line);
+      records++;
+      filled = 0;
+      continue;
+    }
+    
+    memmove(window, window + 1, --filled);
+    skipped++;
+  }
+  
+  fprintf(stderr, "%lu kayıt çözüldü, %lu byte atlandı\n", records, skipped);
+  
+  if (in != stdin) {
+    fclose(in);
+  }
+  return 0;
+}
@@ -0,0 +1,117 @@
+// PROFILE_DUMP çıktısını okunur tabloya çeviren ve iki derlemeyi karşılaştıran host aracı
+//
+// Derleme:   g++ -std=c++11 -O2 -o profile_compare tools/profile_compare.cpp
+// Kullanım:  ./profile_compare yeni.bin             (tek döküm)
+//            ./profile_compare eski.bin yeni.bin    (kapsam başına fark)
+//
+// Girdi, seri porttan alınmış ham kayıttır; döküm başlığı "PRF1" sihirli
+// değeri aranarak bulunur, önündeki metin satırları atlanır.
+
+#include <stdio.h>
+#include <string.h>
+#include "../Core/Utils/ProfileHistogram.h"
+
+struct ProfileDump {
+  ProfileDumpHeader header;
+  ProfileHistogram histograms[PROF_SCOPE_COUNT];
+};
+
+static bool readDump(const char* path, ProfileDump& dump) {
+  FILE* in = fopen(path, "rb");
+  if (!in) {
+    perror(path);
+    return false;
+  }
+
+  static unsigned char data[64 * 1024];
+  size_t length = fread(data, 1, sizeof(data), in);
+  fclose(in);
+
+  // Son dökümü kullan (aynı kayıtta birden fazla PROFILE_DUMP olabilir)
+  bool found = false;
+  for (size_t i = 0; i + sizeof(ProfileDumpHeader) <= length; i++) {
+    ProfileDumpHeader header;
+    memcpy(&header, data + i, sizeof(header));
+    if (header.magic != PROFILE_DUMP_MAGIC) {
+      continue;
+    }
+    if (header.version != PROFILE_DUMP_VERSION || header.bucketCount != PROFILE_BUCKETS ||
+        header.scopeCount > PROF_SCOPE_COUNT || header.cpuMhz == 0) {
+      fprintf(stderr, "%s: desteklenmeyen döküm (sürüm %u)\n", path, header.version);
+      continue;
+    }
+    size_t bodySize = header.scopeCount * sizeof(ProfileHistogram);
+    if (i + sizeof(header) + bodySize > length) {
+      break;
+    }
+    memset(&dump, 0, sizeof(dump));
+    dump.header = header;
+    memcpy(dump.histograms, data + i + sizeof(header), bodySize);
+    found = true;
+  }
+
+  if (!found) {
+    fprintf(stderr, "%s: döküm bulunamadı\n", path);
+  }
+  return found;
+}
+
+static unsigned long toUs(const ProfileDump& dump, unsigned long cycles) {
+  return cycles / dump.header.cpuMhz;
+}
+
+static void printDump(const ProfileDump& dump) {
+  printf("çalışma süresi %lu ms, %u MHz\n", (unsigned long)dump.header.uptimeMs, dump.header.cpuMhz);
+  printf("%-10s %10s %9s %9s %9s\n", "kapsam", "adet", "p50(us)", "p99(us)", "max(us)");
+  for (int i = 0; i < PROF_SCOPE_COUNT; i++) {
+    const ProfileHistogram& h = dump.histograms[i];
+    printf("%-10s %10lu %9lu %9lu %9lu\n", kProfileScopeNames[i],
+           (unsigned long)h.count,
+           toUs(dump, ProfileBuckets::percentile(h, 50)),
+           toUs(dump, ProfileBuckets::percentile(h, 99)),
+           toUs(dump, h.maxValue));
+  }
+}
+
+static void printDelta(unsigned long before, unsigned long after) {
+  long diff = (long)after - (long)before;
+  printf(" %6lu->%-6lu", before, after);
+  if (before > 0) {
+    printf("(%+4ld%%)", diff * 100 / (long)before);
+  } else {
+    printf("(   - )");
+  }
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2 || argc > 3) {
+    fprintf(stderr, "kullanım: %s döküm.bin [yeni_döküm.bin]\n", argv[0]);
+    return 1;
+  }
+
+  ProfileDump before;
+  if (!readDump(argv[1], before)) {
+    return 1;
+  }
+  if (argc == 2) {
+    printDump(before);
+    return 0;
+  }
+
+  ProfileDump after;
+  if (!readDump(argv[2], after)) {
+    return 1;
+  }
+
+  printf("%-10s %23s %23s %23s\n", "kapsam", "p50(us)", "p99(us)", "max(us)");
+  for (int i = 0; i < PROF_SCOPE_COUNT; i++) {
+    const ProfileHistogram& a = before.histograms[i];
+    const ProfileHistogram& b = after.histograms[i];
+    printf("%-10s", kProfileScopeNames[i]);
+    printDelta(toUs(before, ProfileBuckets::percentile(a, 50)), toUs(after, ProfileBuckets::percentile(b, 50)));
+    printDelta(toUs(before, ProfileBuckets::percentile(a, 99)), toUs(after, ProfileBuckets::percentile(b, 99)));
+    printDelta(toUs(before, a.maxValue), toUs(after, b.maxValue));
+    printf("\n");
+  }
+  return 0;
+}
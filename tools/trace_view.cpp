@@ -0,0 +1,191 @@
+// TRACE_DUMP çıktısını zaman çizelgesine çeviren host aracı
+//
+// Derleme:   g++ -std=c++11 -O2 -o trace_view tools/trace_view.cpp
+// Kullanım:  ./trace_view kayit.bin            (zaman çizelgesi)
+//            ./trace_view --csv kayit.bin      (olay dizisi; simülasyonda oynatma: tools/trace_replay)
+//            ./trace_view --check kayit.bin    (RX zamanlama kontrolü; hata varsa çıkış kodu 1)
+//
+// Girdi, seri porttan alınmış ham kayıttır; döküm başlığı "TRC1" sihirli
+// değeri aranarak bulunur. Zamanlar ilk kaydın os_getTime() değerine göredir.
+
+#include <stdio.h>
+#include <string.h>
+#include "../Core/Lora/EventTraceFormat.h"
+#include "../Core/Utils/LogEvents.h"
+
+// lmic.h'deki ev_t değerleri
+#define TRACE_EV_TXCOMPLETE       10
+#define TRACE_EV_TXSTART          17
+#define TRACE_EV_RXSTART          19
+#define TRACE_EV_JOIN_TXCOMPLETE  20
+
+// RX penceresi LMIC tarafından açılış anından en fazla bu kadar geç başlatılabilir
+#define TRACE_MAX_RX_LATE_MS      5.0
+// RX2, RX1'den 1 sn sonra; pencere bu tolerans dışında açılırsa hatalı sayılır
+#define TRACE_RX_WINDOW_SLACK_MS  100.0
+
+static TraceDumpHeader header;
+static TraceRecord records[4096];
+
+static bool readTrace(const char* path) {
+  FILE* in = fopen(path, "rb");
+  if (!in) {
+    perror(path);
+    return false;
+  }
+
+  static unsigned char data[256 * 1024];
+  size_t length = fread(data, 1, sizeof(data), in);
+  fclose(in);
+
+  // Son dökümü kullan
+  bool found = false;
+  for (size_t i = 0; i + sizeof(TraceDumpHeader) <= length; i++) {
+    TraceDumpHeader h;
+    memcpy(&h, data + i, sizeof(h));
+    if (h.magic != TRACE_DUMP_MAGIC) {
+      continue;
+    }
+    if (h.version != TRACE_DUMP_VERSION || h.recordSize != sizeof(TraceRecord) ||
+        h.osTicksPerSec == 0 || h.count > sizeof(records) / sizeof(records[0])) {
+      fprintf(stderr, "%s: desteklenmeyen döküm (sürüm %u)\n", path, h.version);
+      continue;
+    }
+    size_t bodySize = h.count * sizeof(TraceRecord);
+    if (i + sizeof(h) + bodySize > length) {
+      break;
+    }
+    header = h;
+    memcpy(records, data + i + sizeof(h), bodySize);
+    found = true;
+  }
+
+  if (!found) {
+    fprintf(stderr, "%s: iz dökümü bulunamadı\n", path);
+  }
+  return found;
+}
+
+// İki tick değeri arasındaki fark (ms); os_getTime taşmasına dayanıklı
+static double ticksToMs(int32_t from, int32_t to) {
+  return (double)(int32_t)(to - from) * 1000.0 / header.osTicksPerSec;
+}
+
+static const char* eventName(uint8_t ev) {
+  return ev < kLmicEventNameCount ? kLmicEventNames[ev] : "?";
+}
+
+static void printTimeline() {
+  printf("%u olay, %lu eski olay ezildi, %lu tick/sn\n\n", header.count,
+         (unsigned long)header.overwritten, (unsigned long)header.osTicksPerSec);
+  printf("%10s %9s  %-16s %9s %3s %7s  %s\n", "t(ms)", "fark(ms)", "olay", "frek(MHz)", "DR", "opmode", "ayrıntı");
+
+  int32_t t0 = header.count ? records[0].osTime : 0;
+  for (uint16_t i = 0; i < header.count; i++) {
+    const TraceRecord& r = records[i];
+    double delta = i ? ticksToMs(records[i - 1].osTime, r.osTime) : 0.0;
+    printf("%10.1f %9.1f  %-16s %9.3f %3u  0x%04X  ",
+           ticksToMs(t0, r.osTime), delta, eventName(r.ev), r.freq / 1e6, r.datarate, r.opmode);
+
+    switch (r.ev) {
+      case TRACE_EV_TXSTART:
+        printf("TX başladı, %u byte", r.dataLen);
+        break;
+      case TRACE_EV_RXSTART: {
+        // rxtime: açılmakta olan pencere; txend: az önce biten iletim
+        double sinceTx = ticksToMs(r.txend, r.rxtime);
+        double late = ticksToMs(r.rxtime, r.osTime);
+        int window = sinceTx < r.rxDelay * 1000.0 + 500.0 ? 1 : 2;
+        printf("RX%d açılışı TX bitişi+%.1f ms (beklenen %u ms), olay gecikmesi %.1f ms, rxsyms %u",
+               window, sinceTx, r.rxDelay * 1000 + (window == 2 ? 1000 : 0), late, r.rxsyms);
+        break;
+      }
+      case TRACE_EV_TXCOMPLETE:
+      case TRACE_EV_JOIN_TXCOMPLETE:
+        printf("TX bitişi t=%.1f ms, son RX açılışı TX+%.1f ms, alınan %u byte%s",
+               ticksToMs(t0, r.txend), ticksToMs(r.txend, r.rxtime), r.dataLen,
+               (r.txrxFlags & 0x80) ? ", ACK" : "");
+        break;
+      default:
+        break;
+    }
+    printf("\n");
+  }
+}
+
+static void printCsv() {
+  // Simülasyonda olayları aynı aralıklarla yeniden üretmek için yeterli alanlar
+  printf("t_ms,ev,name,opmode,freq,dr,rxtime_ms,txend_ms,rx_delay,rxsyms,data_len,txrx_flags\n");
+  int32_t t0 = header.count ? records[0].osTime : 0;
+  for (uint16_t i = 0; i < header.count; i++) {
+    const TraceRecord& r = records[i];
+    // Henüz atanmamış (0) rxtime/txend boş bırakılır
+    printf("%.3f,%u,%s,%u,%lu,%u,", ticksToMs(t0, r.osTime), r.ev, eventName(r.ev), r.opmode,
+           (unsigned long)r.freq, r.datarate);
+    if (r.rxtime) printf("%.3f", ticksToMs(t0, r.rxtime));
+    printf(",");
+    if (r.txend) printf("%.3f", ticksToMs(t0, r.txend));
+    printf(",%u,%u,%u,%u\n", r.rxDelay, r.rxsyms, r.dataLen, r.txrxFlags);
+  }
+}
+
+// Her RX açılışı beklenen pencereye denk gelmeli ve geç başlatılmamalı
+static int check() {
+  int failures = 0;
+  int windows = 0;
+  for (uint16_t i = 0; i < header.count; i++) {
+    const TraceRecord& r = records[i];
+    if (r.ev != TRACE_EV_RXSTART) {
+      continue;
+    }
+    windows++;
+
+    double sinceTx = ticksToMs(r.txend, r.rxtime);
+    double rx1 = r.rxDelay * 1000.0;
+    double rx2 = rx1 + 1000.0;
+    double late = ticksToMs(r.rxtime, r.osTime);
+    bool inRx1 = sinceTx > rx1 - TRACE_RX_WINDOW_SLACK_MS && sinceTx <= rx1;
+    bool inRx2 = sinceTx > rx2 - TRACE_RX_WINDOW_SLACK_MS && sinceTx <= rx2;
+
+    if (!inRx1 && !inRx2) {
+      printf("HATA olay %u: RX açılışı TX+%.1f ms, RX1 (%.0f) veya RX2 (%.0f) ile uyuşmuyor\n",
+             i, sinceTx, rx1, rx2);
+      failures++;
+    }
+    if (late > TRACE_MAX_RX_LATE_MS) {
+      printf("HATA olay %u: RX %.1f ms geç başlatıldı (sınır %.1f ms)\n", i, late, TRACE_MAX_RX_LATE_MS);
+      failures++;
+    }
+  }
+
+  printf("%d RX penceresi kontrol edildi, %d hata\n", windows, failures);
+  return failures ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+  const char* mode = "";
+  const char* path = nullptr;
+  if (argc == 2) {
+    path = argv[1];
+  } else if (argc == 3 && (!strcmp(argv[1], "--csv") || !strcmp(argv[1], "--check"))) {
+    mode = argv[1];
+    path = argv[2];
+  } else {
+    fprintf(stderr, "kullanım: %s [--csv|--check] iz.bin\n", argv[0]);
+    return 2;
+  }
+
+  if (!readTrace(path)) {
+    return 2;
+  }
+
+  if (!strcmp(mode, "--csv")) {
+    printCsv();
+    return 0;
+  }
+  if (!strcmp(mode, "--check")) {
+    return check();
+  }
+  printTimeline();
+  return 0;
+}